@@ -0,0 +1,218 @@
+#ifndef EXTERNAL_SORT_H
+#define EXTERNAL_SORT_H
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <random>
+#include <cstdint>
+#include <algorithm>
+#include <filesystem>
+#include "Student.h"
+#include "Sort.h"
+#include "StudentLoader.h"
+
+// --- External (out-of-core) merge sort ---
+//
+// 1. Stream the input, collecting rows until the memory budget is reached,
+//    introsort the run and spill it to a temporary binary run file.
+// 2. Merge the runs with a k-way loser tree while streaming CSV to the output.
+//    If there are more runs than MAX_MERGE_FAN_IN, groups of runs are merged
+//    into longer runs first.
+// Run files hold records in writeStudentRecord's binary form, so scores
+// round-trip exactly.
+
+const std::size_t MAX_MERGE_FAN_IN = 64;
+
+inline std::size_t estimateStudentBytes(const Student& s) {
+    const std::size_t inlineCapacity = std::string().capacity(); // small-string buffer
+    std::size_t bytes = sizeof(Student);
+    if (s.id.capacity() > inlineCapacity) bytes += s.id.capacity() + 1;
+    if (s.name.capacity() > inlineCapacity) bytes += s.name.capacity() + 1;
+    return bytes;
+}
+
+// Sequential reader over one run file, holding its current head record
+struct RunReader {
+    std::ifstream in;
+    Student current;
+    bool exhausted = false;
+
+    explicit RunReader(const std::string& path) : in(path, std::ios::binary) { advance(); }
+    void advance() { exhausted = !readStudentRecord(in, current); }
+};
+
+// Loser tree over k run readers. tree[0] holds the overall winner, tree[1..k-1]
+// the loser of the match played at each internal node; leaf i sits at k + i.
+template <typename Less>
+class LoserTree {
+private:
+    std::vector<std::unique_ptr<RunReader>>& runs;
+    std::vector<std::size_t> tree;
+    std::size_t k;
+    Less less;
+
+    // True if run a's head should be emitted before run b's
+    bool beats(std::size_t a, std::size_t b) const {
+        if (runs[a]->exhausted) return false;
+        if (runs[b]->exhausted) return true;
+        if (less(runs[a]->current, runs[b]->current)) return true;
+        if (less(runs[b]->current, runs[a]->current)) return false;
+        return a < b;
+    }
+
+    // Play a full tournament below node, returning the winner
+    std::size_t build(std::size_t node) {
+        if (node >= k) return node - k;
+        std::size_t l = build(2 * node);
+        std::size_t r = build(2 * node + 1);
+        if (beats(l, r)) {
+            tree[node] = r;
+            return l;
+        }
+        tree[node] = l;
+        return r;
+    }
+
+public:
+    LoserTree(std::vector<std::unique_ptr<RunReader>>& r, Less lessFn)
+        : runs(r), tree(r.size(), 0), k(r.size()), less(lessFn) {
+        tree[0] = k == 1 ? 0 : build(1);
+    }
+
+    std::size_t winner() const { return tree[0]; }
+    bool empty() const { return runs[tree[0]]->exhausted; }
+
+    // Advance the winning run and replay its path to the root
+    void pop() {
+        std::size_t w = tree[0];
+        runs[w]->advance();
+        for (std::size_t node = (w + k) / 2; node > 0; node /= 2) {
+            if (beats(tree[node], w)) std::swap(tree[node], w);
+        }
+        tree[0] = w;
+    }
+};
+
+class ExternalSorter {
+private:
+    std::size_t memoryBudget;
+    std::filesystem::path tempDir;
+    std::string tag;
+    std::size_t runCounter = 0;
+    std::vector<std::string> tempFiles;
+
+    std::string nextRunPath() {
+        std::string path = (tempDir / ("student_run_" + tag + "_" + std::to_string(runCounter++) + ".bin")).string();
+        tempFiles.push_back(path);
+        return path;
+    }
+
+    // Sort rows into a new run file appended to runs; false if the run could
+    // not be written in full (e.g. the temporary disk is full)
+    template <typename Less>
+    bool spillRun(std::vector<Student>& rows, Less less, std::vector<std::string>& runs) {
+        if (rows.size() > 1) introSort(rows, 0, rows.size(), less);
+        std::string path = nextRunPath();
+        std::ofstream out(path, std::ios::binary);
+        for (const Student& s : rows) writeStudentRecord(out, s);
+        rows.clear();
+        out.close();
+        if (!out) {
+            std::cerr << "Error writing run file: " << path << std::endl;
+            return false;
+        }
+        runs.push_back(path);
+        return true;
+    }
+
+    // Merge `paths` and hand every record, in order, to emit
+    template <typename Less, typename Emit>
+    void mergeRuns(const std::vector<std::string>& paths, Less less, Emit emit) {
+        std::vector<std::unique_ptr<RunReader>> readers;
+        for (const std::string& p : paths) readers.push_back(std::make_unique<RunReader>(p));
+        LoserTree<Less> tree(readers, less);
+        while (!tree.empty()) {
+            emit(readers[tree.winner()]->current);
+            tree.pop();
+        }
+    }
+
+public:
+    explicit ExternalSorter(std::size_t budgetBytes)
+        : memoryBudget(budgetBytes), tempDir(std::filesystem::temp_directory_path()) {
+        std::random_device rd;
+        tag = std::to_string(rd());
+    }
+
+    ~ExternalSorter() {
+        std::error_code ec;
+        for (const std::string& p : tempFiles) std::filesystem::remove(p, ec);
+    }
+
+    // Sort the "ID Name Score" file and stream it as CSV to out
+    template <typename Less>
+    bool sortFile(const std::string& filename, std::ostream& out, Less less) {
+        // Phase 1: runs that fit in the budget
+        std::vector<std::string> runs;
+        std::vector<Student> rows;
+        std::size_t used = 0;
+        bool failed = false;
+        bool opened = streamStudentFile(filename, [&](std::string_view id, std::string_view name, float score) {
+            if (failed) return;
+            rows.push_back({std::string(id), std::string(name), score});
+            used += estimateStudentBytes(rows.back());
+            // The vector's own buffer counts against the budget too
+            if (used + rows.capacity() * sizeof(Student) >= memoryBudget) {
+                failed = !spillRun(rows, less, runs);
+                rows.shrink_to_fit();
+                used = 0;
+            }
+        });
+        if (!opened || failed) return false;
+
+        out << "id,name,score\n";
+        if (runs.empty()) {
+            // Everything fit in memory: no temporary files needed
+            if (rows.size() > 1) introSort(rows, 0, rows.size(), less);
+            for (const Student& s : rows) out << s.id << ',' << s.name << ',' << s.score << '\n';
+            out.flush();
+            return static_cast<bool>(out);
+        }
+        if (!rows.empty() && !spillRun(rows, less, runs)) return false;
+        std::vector<Student>().swap(rows);
+
+        // Phase 2a: reduce the number of runs to the merge fan-in
+        while (runs.size() > MAX_MERGE_FAN_IN) {
+            std::vector<std::string> merged;
+            for (std::size_t i = 0; i < runs.size(); i += MAX_MERGE_FAN_IN) {
+                std::vector<std::string> group(runs.begin() + i,
+                                               runs.begin() + std::min(runs.size(), i + MAX_MERGE_FAN_IN));
+                std::string path = nextRunPath();
+                std::ofstream runOut(path, std::ios::binary);
+                mergeRuns(group, less, [&runOut](const Student& s) { writeStudentRecord(runOut, s); });
+                runOut.close();
+                if (!runOut) {
+                    std::cerr << "Error writing run file: " << path << std::endl;
+                    return false;
+                }
+                std::error_code ec;
+                for (const std::string& p : group) std::filesystem::remove(p, ec);
+                merged.push_back(path);
+            }
+            runs.swap(merged);
+        }
+
+        // Phase 2b: final merge straight to the output
+        mergeRuns(runs, less, [&out](const Student& s) {
+            out << s.id << ',' << s.name << ',' << s.score << '\n';
+        });
+        out.flush();
+        return static_cast<bool>(out);
+    }
+};
+
+#endif // EXTERNAL_SORT_H
@@ -0,0 +1,184 @@
+#ifndef GRADE_STATS_H
+#define GRADE_STATS_H
+
+#include <ostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define GRADE_STATS_SSE2 1
+#endif
+
+// --- One-pass grade statistics ---
+//
+// A single sweep over the contiguous score column produces count, sum, sum of
+// squares (shifted by the first score to avoid cancellation), min, max and a
+// fixed 10-point histogram. The sweep uses SSE2 where available and a scalar
+// loop otherwise. Percentiles are then found by selection (nth_element) on a
+// scratch copy instead of a full sort. NaN and infinite scores are left out
+// of every figure, count included: they make the shifted sum non-finite, and
+// only then is the column filtered and swept again.
+
+const int HISTOGRAM_BINS = 10; // [0,10), [10,20), ..., [90,100]
+const double STATS_PERCENTILES[] = {10, 25, 50, 75, 90, 99};
+const std::size_t STATS_PERCENTILE_COUNT = sizeof(STATS_PERCENTILES) / sizeof(STATS_PERCENTILES[0]);
+
+struct GradeStats {
+    std::size_t count = 0;
+    double mean = 0;
+    double stddev = 0; // population standard deviation
+    float min = 0;
+    float max = 0;
+    double percentiles[STATS_PERCENTILE_COUNT] = {0};
+    std::size_t histogram[HISTOGRAM_BINS] = {0};
+    std::size_t below = 0; // scores < 0
+    std::size_t above = 0; // scores > 100
+};
+
+// NaN falls in no bin (the sweep is redone without it)
+inline void addToHistogram(GradeStats& st, float x) {
+    if (x < 0.0f) {
+        ++st.below;
+    } else if (x > 100.0f) {
+        ++st.above;
+    } else if (x >= 0.0f) {
+        int bin = static_cast<int>(x / 10.0f);
+        ++st.histogram[bin < HISTOGRAM_BINS ? bin : HISTOGRAM_BINS - 1];
+    }
+}
+
+// Linear interpolation between closest ranks (numpy's default), p in [0, 100]
+inline void selectPercentiles(std::vector<float>& scratch, GradeStats& st) {
+    std::size_t n = scratch.size();
+    std::size_t searchFrom = 0; // everything before is <= the last selected rank
+    for (std::size_t i = 0; i < STATS_PERCENTILE_COUNT; ++i) {
+        double pos = STATS_PERCENTILES[i] / 100.0 * static_cast<double>(n - 1);
+        std::size_t lo = static_cast<std::size_t>(pos);
+        std::nth_element(scratch.begin() + searchFrom, scratch.begin() + lo, scratch.end());
+        double value = scratch[lo];
+        if (lo + 1 < n && pos > static_cast<double>(lo)) {
+            // The next rank is the minimum of the upper partition
+            float next = *std::min_element(scratch.begin() + lo + 1, scratch.end());
+            value += (pos - static_cast<double>(lo)) * (static_cast<double>(next) - value);
+        }
+        st.percentiles[i] = value;
+        searchFrom = lo;
+    }
+}
+
+inline GradeStats computeGradeStats(const float* scores, std::size_t n) {
+    GradeStats st;
+    st.count = n;
+    if (n == 0) return st;
+
+    const double shift = scores[0];
+    double sum = 0, sumSq = 0;
+    float mn = scores[0], mx = scores[0];
+    std::size_t i = 0;
+
+#ifdef GRADE_STATS_SSE2
+    __m128 vmin = _mm_set1_ps(scores[0]);
+    __m128 vmax = vmin;
+    __m128d vshift = _mm_set1_pd(shift);
+    __m128d vsum = _mm_setzero_pd(), vsq = _mm_setzero_pd();
+    for (; i + 4 <= n; i += 4) {
+        __m128 v = _mm_loadu_ps(scores + i);
+        vmin = _mm_min_ps(vmin, v);
+        vmax = _mm_max_ps(vmax, v);
+        __m128d lo = _mm_sub_pd(_mm_cvtps_pd(v), vshift);
+        __m128d hi = _mm_sub_pd(_mm_cvtps_pd(_mm_movehl_ps(v, v)), vshift);
+        vsum = _mm_add_pd(vsum, _mm_add_pd(lo, hi));
+        vsq = _mm_add_pd(vsq, _mm_add_pd(_mm_mul_pd(lo, lo), _mm_mul_pd(hi, hi)));
+        addToHistogram(st, scores[i]);
+        addToHistogram(st, scores[i + 1]);
+        addToHistogram(st, scores[i + 2]);
+        addToHistogram(st, scores[i + 3]);
+    }
+    alignas(16) float lanes[4];
+    _mm_store_ps(lanes, vmin);
+    mn = std::min(std::min(lanes[0], lanes[1]), std::min(lanes[2], lanes[3]));
+    _mm_store_ps(lanes, vmax);
+    mx = std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+    alignas(16) double pair[2];
+    _mm_store_pd(pair, vsum);
+    sum = pair[0] + pair[1];
+    _mm_store_pd(pair, vsq);
+    sumSq = pair[0] + pair[1];
+#endif
+
+    // Scalar tail (or the whole array without SSE2)
+    for (; i < n; ++i) {
+        float x = scores[i];
+        mn = std::min(mn, x);
+        mx = std::max(mx, x);
+        double d = x - shift;
+        sum += d;
+        sumSq += d * d;
+        addToHistogram(st, x);
+    }
+
+    if (!std::isfinite(sum)) {
+        std::vector<float> finite;
+        finite.reserve(n);
+        for (std::size_t k = 0; k < n; ++k) {
+            if (std::isfinite(scores[k])) finite.push_back(scores[k]);
+        }
+        return computeGradeStats(finite.data(), finite.size());
+    }
+
+    double meanShifted = sum / static_cast<double>(n);
+    st.mean = shift + meanShifted;
+    st.stddev = std::sqrt(std::max(0.0, sumSq / static_cast<double>(n) - meanShifted * meanShifted));
+    st.min = mn;
+    st.max = mx;
+
+    std::vector<float> scratch(scores, scores + n);
+    selectPercentiles(scratch, st);
+    return st;
+}
+
+inline std::string histogramLabel(int bin) {
+    return std::to_string(bin * 10) + "-" + std::to_string(bin * 10 + 10);
+}
+
+// metric,value rows
+inline void printGradeStatsCSV(std::ostream& out, const GradeStats& st) {
+    out << "metric,value\n";
+    out << "count," << st.count << "\n";
+    out << "mean," << st.mean << "\n";
+    out << "stddev," << st.stddev << "\n";
+    out << "min," << st.min << "\n";
+    out << "max," << st.max << "\n";
+    for (std::size_t i = 0; i < STATS_PERCENTILE_COUNT; ++i)
+        out << "p" << STATS_PERCENTILES[i] << "," << st.percentiles[i] << "\n";
+    for (int b = 0; b < HISTOGRAM_BINS; ++b)
+        out << "hist_" << histogramLabel(b) << "," << st.histogram[b] << "\n";
+    out << "hist_below_0," << st.below << "\n";
+    out << "hist_above_100," << st.above << "\n";
+}
+
+inline void printGradeStatsJSON(std::ostream& out, const GradeStats& st) {
+    out << "{\"count\": " << st.count
+        << ", \"mean\": " << st.mean
+        << ", \"stddev\": " << st.stddev
+        << ", \"min\": " << st.min
+        << ", \"max\": " << st.max
+        << ", \"percentiles\": {";
+    for (std::size_t i = 0; i < STATS_PERCENTILE_COUNT; ++i) {
+        if (i) out << ", ";
+        out << "\"p" << STATS_PERCENTILES[i] << "\": " << st.percentiles[i];
+    }
+    out << "}, \"histogram\": [";
+    for (int b = 0; b < HISTOGRAM_BINS; ++b) {
+        if (b) out << ", ";
+        out << "{\"bin\": \"" << histogramLabel(b) << "\", \"count\": " << st.histogram[b] << "}";
+    }
+    out << "], \"below_0\": " << st.below << ", \"above_100\": " << st.above << "}\n";
+}
+
+#endif // GRADE_STATS_H
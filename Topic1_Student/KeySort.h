@@ -0,0 +1,81 @@
+#ifndef KEY_SORT_H
+#define KEY_SORT_H
+
+#include <vector>
+#include <tuple>
+#include <utility>
+#include <cstdint>
+#include "Student.h"
+#include "SortKeys.h"
+#include "Sort.h"
+
+// --- Multi-key sort over encoded keys ---
+//
+// Each row is encoded once into a small record of fixed-width key codes (see
+// KeyTraits::encode) plus its row index, and the records are sorted instead
+// of the Students. Most comparisons are then a few integer compares on
+// contiguous memory; only when two string prefixes tie does the comparator go
+// back to the full strings. Ties on every key keep input order.
+template <typename... Keys>
+class KeySorter {
+private:
+    static const std::size_t N = sizeof...(Keys);
+
+    struct Record {
+        uint64_t code[N];
+        uint32_t row;
+    };
+
+    template <std::size_t I>
+    using KeyAt = std::tuple_element_t<I, std::tuple<Keys...>>;
+
+    struct RecordLess {
+        const std::vector<Student>* rows;
+
+        template <std::size_t I>
+        int compareKey(const Record& a, const Record& b) const {
+            if (a.code[I] != b.code[I]) return a.code[I] < b.code[I] ? -1 : 1;
+            if (KeyAt<I>::exact) return 0;
+            return KeyAt<I>::compare((*rows)[a.row], (*rows)[b.row]);
+        }
+
+        template <std::size_t... I>
+        int compareAll(const Record& a, const Record& b, std::index_sequence<I...>) const {
+            int c = 0;
+            (void)(((c = compareKey<I>(a, b)) != 0) || ...);
+            return c;
+        }
+
+        bool operator()(const Record& a, const Record& b) const {
+            int c = compareAll(a, b, std::index_sequence_for<Keys...>());
+            return c != 0 ? c < 0 : a.row < b.row;
+        }
+    };
+
+public:
+    // Row order of `rows` under KeyLess<Keys...>
+    static std::vector<uint32_t> order(const std::vector<Student>& rows) {
+        std::vector<Record> records(rows.size());
+        for (std::size_t r = 0; r < rows.size(); ++r) {
+            Record& rec = records[r];
+            std::size_t k = 0;
+            ((rec.code[k++] = Keys::encode(rows[r])), ...);
+            rec.row = static_cast<uint32_t>(r);
+        }
+        if (records.size() > 1) introSort(records, 0, records.size(), RecordLess{&rows});
+
+        std::vector<uint32_t> result(records.size());
+        for (std::size_t i = 0; i < records.size(); ++i) result[i] = records[i].row;
+        return result;
+    }
+};
+
+// Named orderings: the command-line sort modes, and the key-sort
+// counterparts of sort_id / sort_score timed by bench_student_sort
+using ScoreIdKeys = KeySorter<Key<ScoreField, true>, Key<IdField>, Key<NameField>>;
+using ScoreAscKeys = KeySorter<Key<ScoreField>, Key<IdField>, Key<NameField>>;
+using NameKeys = KeySorter<Key<NameField>, Key<IdField>, Key<ScoreField>>;
+using IdNumberKeys = KeySorter<Key<IdNumberField>, Key<IdField>, Key<NameField>, Key<ScoreField>>;
+using IdKeys = KeySorter<Key<IdField>, Key<NameField>, Key<ScoreField>>;
+
+#endif // KEY_SORT_H
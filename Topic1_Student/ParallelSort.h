@@ -0,0 +1,176 @@
+#ifndef PARALLEL_SORT_H
+#define PARALLEL_SORT_H
+
+#include <vector>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <algorithm>
+#include <utility>
+#include "Student.h"
+#include "Sort.h"
+
+// --- Thread Pool ---
+
+class ThreadPool {
+private:
+    std::vector<std::thread> workers;
+    std::queue<std::function<void()>> tasks;
+    std::mutex mtx;
+    std::condition_variable taskReady;
+    std::condition_variable allDone;
+    std::size_t pending = 0;
+    bool stopping = false;
+
+    void workerLoop() {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mtx);
+                taskReady.wait(lock, [this] { return stopping || !tasks.empty(); });
+                if (stopping && tasks.empty()) return;
+                task = std::move(tasks.front());
+                tasks.pop();
+            }
+            task();
+            {
+                std::lock_guard<std::mutex> lock(mtx);
+                if (--pending == 0) allDone.notify_all();
+            }
+        }
+    }
+
+public:
+    explicit ThreadPool(unsigned threadCount) {
+        if (threadCount == 0) threadCount = 1;
+        for (unsigned i = 0; i < threadCount; ++i)
+            workers.emplace_back(&ThreadPool::workerLoop, this);
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            stopping = true;
+        }
+        taskReady.notify_all();
+        for (auto& t : workers) t.join();
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    void submit(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            tasks.push(std::move(task));
+            ++pending;
+        }
+        taskReady.notify_one();
+    }
+
+    // Block until every submitted task has finished
+    void wait() {
+        std::unique_lock<std::mutex> lock(mtx);
+        allDone.wait(lock, [this] { return pending == 0; });
+    }
+};
+
+// --- Parallel Sort (chunk sort + parallel multiway merge) ---
+//
+// 1. Split the array into one chunk per thread and introsort the chunks.
+// 2. Pick threads-1 splitters by regular sampling of the sorted chunks and cut
+//    every chunk at each splitter (lower_bound), so output segment j is the
+//    union of slice j of every chunk.
+// 3. Merge the slices of each segment on its own thread with a k-way heap merge
+//    straight into its final position.
+// Less must be a total order (see Sort.h), which makes the result identical to
+// the sequential sort. T is a Student record or a StudentTable row index.
+
+const std::size_t PARALLEL_SORT_MIN_ROWS = 1 << 14;
+
+template <typename T, typename Less>
+void parallelSort(std::vector<T>& a, unsigned threads, Less less) {
+    std::size_t n = a.size();
+    if (threads <= 1 || n < PARALLEL_SORT_MIN_ROWS) {
+        if (n > 1) introSort(a, 0, n, less);
+        return;
+    }
+
+    std::size_t parts = threads;
+    ThreadPool pool(threads);
+
+    // 1. Sort chunks
+    std::vector<std::size_t> bounds(parts + 1);
+    for (std::size_t c = 0; c <= parts; ++c) bounds[c] = n * c / parts;
+    for (std::size_t c = 0; c < parts; ++c) {
+        pool.submit([&a, &bounds, c, less] { introSort(a, bounds[c], bounds[c + 1], less); });
+    }
+    pool.wait();
+
+    // 2. Regular sampling: parts samples per chunk, then parts-1 splitters
+    std::vector<T> samples;
+    samples.reserve(parts * parts);
+    for (std::size_t c = 0; c < parts; ++c) {
+        std::size_t len = bounds[c + 1] - bounds[c];
+        for (std::size_t s = 0; s < parts; ++s)
+            samples.push_back(a[bounds[c] + len * s / parts]);
+    }
+    std::sort(samples.begin(), samples.end(), less);
+    std::vector<T> splitters;
+    for (std::size_t j = 1; j < parts; ++j)
+        splitters.push_back(samples[j * parts]);
+
+    // cut[c][j]: start of slice j inside chunk c
+    std::vector<std::vector<std::size_t>> cut(parts, std::vector<std::size_t>(parts + 1));
+    for (std::size_t c = 0; c < parts; ++c) {
+        cut[c][0] = bounds[c];
+        cut[c][parts] = bounds[c + 1];
+        for (std::size_t j = 1; j < parts; ++j) {
+            cut[c][j] = std::lower_bound(a.begin() + cut[c][j - 1], a.begin() + bounds[c + 1],
+                                         splitters[j - 1], less) - a.begin();
+        }
+    }
+
+    // Output offset of every segment
+    std::vector<std::size_t> offset(parts + 1, 0);
+    for (std::size_t j = 0; j < parts; ++j) {
+        std::size_t len = 0;
+        for (std::size_t c = 0; c < parts; ++c) len += cut[c][j + 1] - cut[c][j];
+        offset[j + 1] = offset[j] + len;
+    }
+
+    // 3. Merge every segment independently
+    std::vector<T> out(n);
+    for (std::size_t j = 0; j < parts; ++j) {
+        pool.submit([&a, &out, &cut, &offset, parts, j, less] {
+            // Min-heap of (cursor, end) over the non-empty slices
+            std::vector<std::pair<std::size_t, std::size_t>> heads;
+            for (std::size_t c = 0; c < parts; ++c) {
+                if (cut[c][j] < cut[c][j + 1]) heads.push_back({cut[c][j], cut[c][j + 1]});
+            }
+            auto later = [&a, less](const std::pair<std::size_t, std::size_t>& x,
+                                    const std::pair<std::size_t, std::size_t>& y) {
+                return less(a[y.first], a[x.first]);
+            };
+            std::make_heap(heads.begin(), heads.end(), later);
+
+            std::size_t dst = offset[j];
+            while (!heads.empty()) {
+                std::pop_heap(heads.begin(), heads.end(), later);
+                std::pair<std::size_t, std::size_t>& h = heads.back();
+                out[dst++] = std::move(a[h.first++]);
+                if (h.first == h.second) {
+                    heads.pop_back();
+                } else {
+                    std::push_heap(heads.begin(), heads.end(), later);
+                }
+            }
+        });
+    }
+    pool.wait();
+    a.swap(out);
+}
+
+#endif // PARALLEL_SORT_H
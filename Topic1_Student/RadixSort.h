@@ -0,0 +1,114 @@
+#ifndef RADIX_SORT_H
+#define RADIX_SORT_H
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <algorithm>
+#include "Student.h"
+#include "SortKeys.h"
+
+// --- LSD Radix Sort (index permutation) ---
+//
+// Keys are encoded once as fixed-width unsigned integers and sorted byte by
+// byte, least significant first, over an array of row indices. Each pass is a
+// stable counting sort, so the whole sort is O(keyBytes * n) and the Student
+// records themselves are never moved.
+
+// Stable LSD radix sort of `order` by keys[order[i]], looking at the low keyBytes bytes
+inline void radixSortIndices(const std::vector<uint64_t>& keys, int keyBytes, std::vector<uint32_t>& order) {
+    std::size_t n = keys.size();
+    order.resize(n);
+    for (std::size_t i = 0; i < n; ++i) order[i] = static_cast<uint32_t>(i);
+    if (n < 2) return;
+
+    std::vector<uint32_t> buffer(n);
+    for (int pass = 0; pass < keyBytes; ++pass) {
+        int shift = pass * 8;
+        std::size_t count[257] = {0};
+        for (std::size_t i = 0; i < n; ++i)
+            ++count[((keys[i] >> shift) & 0xFF) + 1];
+
+        // Every key shares this byte: the pass would be the identity
+        bool trivial = false;
+        for (int b = 1; b <= 256; ++b) {
+            if (count[b] == n) { trivial = true; break; }
+            if (count[b] != 0) break;
+        }
+        if (trivial) continue;
+
+        for (int b = 0; b < 256; ++b) count[b + 1] += count[b];
+        for (std::size_t i = 0; i < n; ++i) {
+            uint32_t row = order[i];
+            buffer[count[(keys[row] >> shift) & 0xFF]++] = row;
+        }
+        order.swap(buffer);
+    }
+}
+
+// Encode IDs so that integer order equals std::string order.
+// Returns the number of significant key bytes, or 0 if the IDs cannot be encoded.
+inline int encodeIdKeys(const std::vector<Student>& students, std::vector<uint64_t>& keys) {
+    keys.resize(students.size());
+    if (students.empty()) return 0;
+
+    // Fixed-width digit strings (up to 19 digits) compare like their numeric value
+    std::size_t width = students[0].id.size();
+    bool numeric = width > 0 && width <= 19;
+    for (std::size_t i = 0; numeric && i < students.size(); ++i) {
+        const std::string& id = students[i].id;
+        if (id.size() != width) { numeric = false; break; }
+        uint64_t v = 0;
+        for (char c : id) {
+            if (c < '0' || c > '9') { numeric = false; break; }
+            v = v * 10 + static_cast<uint64_t>(c - '0');
+        }
+        keys[i] = v;
+    }
+    if (numeric) {
+        uint64_t maxKey = 0;
+        for (uint64_t k : keys) maxKey = std::max(maxKey, k);
+        int bytes = 1;
+        while (bytes < 8 && (maxKey >> (bytes * 8)) != 0) ++bytes;
+        return bytes;
+    }
+
+    // Otherwise, short IDs (<= 8 bytes) packed big-endian, zero padded
+    for (std::size_t i = 0; i < students.size(); ++i) {
+        const std::string& id = students[i].id;
+        if (id.size() > 8) return 0;
+        keys[i] = packStringPrefix(id);
+    }
+    return 8;
+}
+
+// Row order by ID ascending
+inline std::vector<uint32_t> radixOrderById(const std::vector<Student>& students) {
+    std::vector<uint64_t> keys;
+    std::vector<uint32_t> order;
+    int keyBytes = encodeIdKeys(students, keys);
+    if (keyBytes > 0 || students.empty()) {
+        radixSortIndices(keys, keyBytes, order);
+        return order;
+    }
+
+    // IDs too long for a fixed-width key: fall back to a comparison sort
+    order.resize(students.size());
+    for (std::size_t i = 0; i < order.size(); ++i) order[i] = static_cast<uint32_t>(i);
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+        return students[a].id < students[b].id;
+    });
+    return order;
+}
+
+// Row order by score descending
+inline std::vector<uint32_t> radixOrderByScoreDesc(const std::vector<Student>& students) {
+    std::vector<uint64_t> keys(students.size());
+    for (std::size_t i = 0; i < students.size(); ++i)
+        keys[i] = ~orderedScoreKey(students[i].score); // inverted for descending order
+    std::vector<uint32_t> order;
+    radixSortIndices(keys, 4, order);
+    return order;
+}
+
+#endif // RADIX_SORT_H
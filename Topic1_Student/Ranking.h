@@ -0,0 +1,91 @@
+#ifndef RANKING_H
+#define RANKING_H
+
+#include <vector>
+#include <string>
+#include <string_view>
+#include <cstddef>
+#include <algorithm>
+#include "Student.h"
+#include "Sort.h"
+
+// --- Top-K by score (bounded heap) ---
+//
+// Keeps the best K rows seen so far in a heap ordered like heapSort's, i.e.
+// with the weakest of the K at the root. A new row only replaces the root when
+// it ranks ahead of it, so a whole stream costs O(n log K) time and O(K) memory.
+class TopKCollector {
+private:
+    std::size_t k;
+    std::vector<Student> heap;
+    Student candidate; // reused buffer, avoids per-row allocations
+    ScoreDescLess before;
+
+public:
+    // K comes from the command line, so only a small heap is reserved up
+    // front; it grows with the rows actually seen
+    explicit TopKCollector(std::size_t limit) : k(limit) { heap.reserve(std::min<std::size_t>(limit, 1024)); }
+
+    void offer(std::string_view id, std::string_view name, float score) {
+        if (k == 0) return;
+        if (heap.size() < k) {
+            heap.push_back({std::string(id), std::string(name), score});
+            if (heap.size() == k) {
+                for (int i = static_cast<int>(k) / 2 - 1; i >= 0; i--)
+                    heapify(heap, static_cast<int>(k), i);
+            }
+            return;
+        }
+        // Cheap reject on the score alone before touching the strings
+        if (score < heap[0].score) return;
+        candidate.id.assign(id.data(), id.size());
+        candidate.name.assign(name.data(), name.size());
+        candidate.score = score;
+        if (before(candidate, heap[0])) {
+            std::swap(heap[0], candidate);
+            heapify(heap, static_cast<int>(k), 0);
+        }
+    }
+
+    // The collected rows, in sort_score order
+    std::vector<Student> result() {
+        std::vector<Student> out = heap;
+        heapSort(out);
+        return out;
+    }
+};
+
+// --- Rank by score (two streaming passes) ---
+//
+// Competition rank of `id` by score: 1 + the number of students with a
+// strictly higher score. scan(onRow, reportMalformed) must call
+// onRow(id, name, score) for every row, in the same order each time, and
+// return false if the rows could not be read; bad input is only reported
+// when reportMalformed is set, which is the first pass alone. That pass
+// finds the student (the first row with that ID), the second counts the
+// higher scores, so memory stays O(1) whatever the roster size. Returns false if the rows could not be read;
+// found is false if the ID is not present.
+template <typename Scan>
+bool rankByScore(Scan scan, std::string_view id, Student& student, std::size_t& rank, std::size_t& total,
+                 bool& found) {
+    found = false;
+    auto findStudent = [&](std::string_view rowId, std::string_view name, float score) {
+        if (found || rowId != id) return;
+        student = {std::string(rowId), std::string(name), score};
+        found = true;
+    };
+    if (!scan(findStudent, true)) return false;
+    if (!found) return true;
+
+    std::size_t higher = 0, rows = 0;
+    auto countHigher = [&](std::string_view, std::string_view, float score) {
+        higher += score > student.score;
+        rows++;
+    };
+    if (!scan(countHigher, false)) return false;
+    rank = higher + 1;
+    total = rows;
+    return true;
+}
+
+#endif // RANKING_H
@@ -0,0 +1,197 @@
+#ifndef SORT_H
+#define SORT_H
+
+#include <vector>
+#include <cstddef>
+#include <utility>
+#include "Student.h"
+#include "SortKeys.h"
+
+// Orderings used by the CLI commands (see SortKeys.h).
+// Both are total orders over the whole record, so any correct sort (the
+// sequential and the parallel paths alike) prints exactly the same bytes.
+
+// ID ascending, then name, then score
+struct IdLess : KeyLess<Key<IdField>, Key<NameField>, Key<ScoreField>> {};
+
+// Score descending, then ID ascending, then name
+struct ScoreDescLess : KeyLess<Key<ScoreField, true>, Key<IdField>, Key<NameField>> {};
+
+// --- IntroSort Implementation (Ascending by ID) ---
+//
+// Hybrid quicksort: ninther / median-of-three pivot, three-way partitioning so
+// runs of equal keys are finished in one pass, insertion sort for small ranges
+// and a heapsort fallback once the recursion budget (2 * log2 n) is exhausted.
+// The smaller side is recursed into and the larger one is looped on, so stack
+// depth stays O(log n) even on adversarial input. The helpers are generic over
+// the element type so the same engine sorts Student records and row indices.
+
+const std::size_t INSERTION_SORT_THRESHOLD = 24;
+const std::size_t NINTHER_THRESHOLD = 128;
+
+template <typename T, typename Less>
+void insertionSort(std::vector<T>& a, std::size_t lo, std::size_t hi, Less less) {
+    for (std::size_t i = lo + 1; i < hi; ++i) {
+        if (!less(a[i], a[i - 1])) continue;
+        T tmp = std::move(a[i]);
+        std::size_t j = i;
+        do {
+            a[j] = std::move(a[j - 1]);
+            --j;
+        } while (j > lo && less(tmp, a[j - 1]));
+        a[j] = std::move(tmp);
+    }
+}
+
+// Sift a[lo + i] down inside the max-heap a[lo, lo + n)
+template <typename T, typename Less>
+void siftDown(std::vector<T>& a, std::size_t lo, std::size_t n, std::size_t i, Less less) {
+    while (true) {
+        std::size_t largest = i;
+        std::size_t l = 2 * i + 1;
+        std::size_t r = l + 1;
+        if (l < n && less(a[lo + largest], a[lo + l])) largest = l;
+        if (r < n && less(a[lo + largest], a[lo + r])) largest = r;
+        if (largest == i) return;
+        std::swap(a[lo + i], a[lo + largest]);
+        i = largest;
+    }
+}
+
+template <typename T, typename Less>
+void heapSortRange(std::vector<T>& a, std::size_t lo, std::size_t hi, Less less) {
+    std::size_t n = hi - lo;
+    if (n < 2) return;
+    for (std::size_t i = n / 2; i-- > 0;)
+        siftDown(a, lo, n, i, less);
+    for (std::size_t i = n - 1; i > 0; --i) {
+        std::swap(a[lo], a[lo + i]);
+        siftDown(a, lo, i, 0, less);
+    }
+}
+
+// Order a[i], a[j], a[k] so that a[j] holds the median of the three
+template <typename T, typename Less>
+void sort3(std::vector<T>& a, std::size_t i, std::size_t j, std::size_t k, Less less) {
+    if (less(a[j], a[i])) std::swap(a[i], a[j]);
+    if (less(a[k], a[j])) {
+        std::swap(a[j], a[k]);
+        if (less(a[j], a[i])) std::swap(a[i], a[j]);
+    }
+}
+
+// Move a pivot candidate to a[lo]
+template <typename T, typename Less>
+void choosePivot(std::vector<T>& a, std::size_t lo, std::size_t hi, Less less) {
+    std::size_t n = hi - lo;
+    std::size_t mid = lo + n / 2;
+    if (n > NINTHER_THRESHOLD) {
+        // Tukey's ninther: median of the medians of three spread-out triples
+        std::size_t s = n / 8;
+        sort3(a, lo, lo + s, lo + 2 * s, less);
+        sort3(a, mid - s, mid, mid + s, less);
+        sort3(a, hi - 1 - 2 * s, hi - 1 - s, hi - 1, less);
+        sort3(a, lo + s, mid, hi - 1 - s, less);
+    } else {
+        sort3(a, lo, mid, hi - 1, less);
+    }
+    std::swap(a[lo], a[mid]);
+}
+
+// Dijkstra three-way partition around a[lo].
+// Afterwards a[lo, lt) < pivot, a[lt, gt) == pivot, a[gt, hi) > pivot.
+template <typename T, typename Less>
+std::pair<std::size_t, std::size_t> partition3(std::vector<T>& a, std::size_t lo, std::size_t hi, Less less) {
+    T pivot = a[lo];
+    std::size_t lt = lo, i = lo + 1, gt = hi;
+    while (i < gt) {
+        if (less(a[i], pivot)) {
+            std::swap(a[lt++], a[i++]);
+        } else if (less(pivot, a[i])) {
+            std::swap(a[i], a[--gt]);
+        } else {
+            ++i;
+        }
+    }
+    return {lt, gt};
+}
+
+template <typename T, typename Less>
+void introSort(std::vector<T>& a, std::size_t lo, std::size_t hi, Less less) {
+    std::size_t depthLimit = 0;
+    for (std::size_t n = hi - lo; n > 1; n >>= 1) depthLimit += 2;
+
+    while (hi - lo > INSERTION_SORT_THRESHOLD) {
+        if (depthLimit == 0) {
+            heapSortRange(a, lo, hi, less);
+            return;
+        }
+        --depthLimit;
+
+        choosePivot(a, lo, hi, less);
+        std::pair<std::size_t, std::size_t> eq = partition3(a, lo, hi, less);
+
+        // Recurse on the smaller side, loop on the larger one
+        if (eq.first - lo < hi - eq.second) {
+            introSort(a, lo, eq.first, less);
+            lo = eq.second;
+        } else {
+            introSort(a, eq.second, hi, less);
+            hi = eq.first;
+        }
+    }
+    insertionSort(a, lo, hi, less);
+}
+
+// Sorts students[low..high] (inclusive) by ID ascending
+inline void quickSort(std::vector<Student>& students, int low, int high) {
+    if (low < high) {
+        introSort(students, static_cast<std::size_t>(low), static_cast<std::size_t>(high) + 1, IdLess());
+    }
+}
+
+// --- HeapSort Implementation (Descending by Score) ---
+// `before` is the output order; heapify keeps the element that comes last at
+// the root, so repeatedly moving the root to the end yields that order.
+
+template <typename T, typename Less = ScoreDescLess>
+void heapify(std::vector<T>& students, int n, int i, Less before = Less()) {
+    int smallest = i; // Initialize smallest as root
+    int l = 2 * i + 1; // left = 2*i + 1
+    int r = 2 * i + 2; // right = 2*i + 2
+
+    // If left child is smaller than root (ties broken by ID, then name)
+    if (l < n && before(students[smallest], students[l]))
+        smallest = l;
+
+    // If right child is smaller than smallest so far
+    if (r < n && before(students[smallest], students[r]))
+        smallest = r;
+
+    // If smallest is not root
+    if (smallest != i) {
+        std::swap(students[i], students[smallest]);
+        // Recursively heapify the affected sub-tree
+        heapify(students, n, smallest, before);
+    }
+}
+
+template <typename T, typename Less = ScoreDescLess>
+void heapSort(std::vector<T>& students, Less before = Less()) {
+    int n = students.size();
+
+    // Build heap (rearrange array)
+    for (int i = n / 2 - 1; i >= 0; i--)
+        heapify(students, n, i, before);
+
+    // One by one extract an element from heap
+    for (int i = n - 1; i > 0; i--) {
+        // Move current root to end
+        std::swap(students[0], students[i]);
+
+        // call max heapify on the reduced heap
+        heapify(students, i, 0, before);
+    }
+}
+
+#endif // SORT_H
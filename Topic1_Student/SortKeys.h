@@ -0,0 +1,121 @@
+#ifndef SORT_KEYS_H
+#define SORT_KEYS_H
+
+#include <string_view>
+#include <cstdint>
+#include <cstring>
+#include "Student.h"
+
+// --- Sort keys: field extractors, per-type traits and multi-key orderings ---
+//
+// An ordering is spelled as a list of Key<Field, Descending> and resolved at
+// compile time, e.g.
+//
+//   KeyLess<Key<ScoreField, true>, Key<IdField>>   // score desc, then ID asc
+//
+// Every key compares through KeyTraits of its value type, so each ordering is
+// a distinct, fully inlined comparator with no per-comparison indirection.
+// KeyTraits::encode maps a value to a fixed-width unsigned code with the same
+// order (exact for integers and floats, the packed 8-byte prefix for strings).
+
+// Map a float to an unsigned integer with the same ordering
+inline uint32_t orderedScoreKey(float score) {
+    if (score == 0.0f) score = 0.0f; // -0 and +0 compare equal
+    uint32_t bits;
+    std::memcpy(&bits, &score, sizeof(bits));
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+// First 8 bytes packed big-endian, zero padded: integer order == string order
+inline uint64_t packStringPrefix(std::string_view s) {
+    uint64_t v = 0;
+    for (std::size_t j = 0; j < 8; ++j) {
+        v <<= 8;
+        if (j < s.size()) v |= static_cast<unsigned char>(s[j]);
+    }
+    return v;
+}
+
+template <typename V>
+struct KeyTraits;
+
+template <>
+struct KeyTraits<uint64_t> {
+    static const bool exact = true;
+    static uint64_t encode(uint64_t v) { return v; }
+    static int compare(uint64_t a, uint64_t b) { return a < b ? -1 : (b < a ? 1 : 0); }
+};
+
+template <>
+struct KeyTraits<float> {
+    static const bool exact = true;
+    static uint64_t encode(float v) { return orderedScoreKey(v); }
+    static int compare(float a, float b) { return a < b ? -1 : (b < a ? 1 : 0); }
+};
+
+template <>
+struct KeyTraits<std::string_view> {
+    static const bool exact = false; // equal prefixes still need the full compare
+    static uint64_t encode(std::string_view v) { return packStringPrefix(v); }
+    static int compare(std::string_view a, std::string_view b) {
+        int c = a.compare(b);
+        return c < 0 ? -1 : (c > 0 ? 1 : 0);
+    }
+};
+
+// Field extractors
+
+struct IdField {
+    using value_type = std::string_view;
+    static value_type get(const Student& s) { return s.id; }
+};
+
+struct NameField {
+    using value_type = std::string_view;
+    static value_type get(const Student& s) { return s.name; }
+};
+
+struct ScoreField {
+    using value_type = float;
+    static value_type get(const Student& s) { return s.score; }
+};
+
+// Numeric value of the ID's digits (non-digits are skipped)
+struct IdNumberField {
+    using value_type = uint64_t;
+    static value_type get(const Student& s) {
+        uint64_t v = 0;
+        for (char c : s.id) {
+            if (c >= '0' && c <= '9') v = v * 10 + static_cast<uint64_t>(c - '0');
+        }
+        return v;
+    }
+};
+
+template <typename Field, bool Descending = false>
+struct Key {
+    using field = Field;
+    using traits = KeyTraits<typename Field::value_type>;
+    static const bool exact = traits::exact;
+
+    static int compare(const Student& a, const Student& b) {
+        int c = traits::compare(Field::get(a), Field::get(b));
+        return Descending ? -c : c;
+    }
+    static uint64_t encode(const Student& s) {
+        uint64_t code = traits::encode(Field::get(s));
+        return Descending ? ~code : code;
+    }
+};
+
+// Lexicographic ordering over Keys...
+template <typename... Keys>
+struct KeyLess {
+    bool operator()(const Student& a, const Student& b) const {
+        int c = 0;
+        (void)(((c = Keys::compare(a, b)) != 0) || ...);
+        return c < 0;
+    }
+};
+
+#endif // SORT_KEYS_H
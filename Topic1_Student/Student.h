@@ -4,6 +4,7 @@
 #include <string>
 #include <iostream>
 #include <iomanip>
+#include <cstdint>
 
 struct Student {
     std::string id;
@@ -25,4 +26,27 @@ inline void printStudent(const Student& s) {
               << std::setw(10) << s.score << std::endl;
 }
 
+// Binary record: [u32 id length][id][u32 name length][name][float score]
+inline void writeStudentRecord(std::ostream& out, const Student& s) {
+    uint32_t idLen = static_cast<uint32_t>(s.id.size());
+    uint32_t nameLen = static_cast<uint32_t>(s.name.size());
+    out.write(reinterpret_cast<const char*>(&idLen), sizeof(idLen));
+    out.write(s.id.data(), idLen);
+    out.write(reinterpret_cast<const char*>(&nameLen), sizeof(nameLen));
+    out.write(s.name.data(), nameLen);
+    out.write(reinterpret_cast<const char*>(&s.score), sizeof(s.score));
+}
+
+inline bool readStudentRecord(std::istream& in, Student& s) {
+    uint32_t len = 0;
+    if (!in.read(reinterpret_cast<char*>(&len), sizeof(len))) return false;
+    s.id.resize(len);
+    in.read(&s.id[0], len);
+    in.read(reinterpret_cast<char*>(&len), sizeof(len));
+    s.name.resize(len);
+    in.read(&s.name[0], len);
+    in.read(reinterpret_cast<char*>(&s.score), sizeof(s.score));
+    return static_cast<bool>(in);
+}
+
 #endif // STUDENT_H
@@ -0,0 +1,236 @@
+#ifndef STUDENT_INDEX_H
+#define STUDENT_INDEX_H
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <filesystem>
+#include "Student.h"
+#include "Sort.h"
+
+// --- Sorted block list ---
+//
+// A sorted sequence kept as a list of small sorted blocks (the leaf level of a
+// B+-tree with a flat directory). Finding a position is a binary search over
+// the block maxima and then inside one block, and an insert or erase shifts at
+// most MAX_BLOCK elements, so single-row updates cost O(log n + B) instead of
+// a full re-sort.
+template <typename Less>
+class SortedBlockList {
+private:
+    static const std::size_t MAX_BLOCK = 512;
+
+    std::vector<std::vector<Student>> blocks;
+    std::size_t count = 0;
+    Less less;
+
+    // First block whose last element is not less than s
+    std::size_t findBlock(const Student& s) const {
+        std::size_t lo = 0, hi = blocks.size();
+        while (lo < hi) {
+            std::size_t mid = lo + (hi - lo) / 2;
+            if (less(blocks[mid].back(), s)) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return lo;
+    }
+
+public:
+    std::size_t size() const { return count; }
+
+    void clear() {
+        blocks.clear();
+        count = 0;
+    }
+
+    // Replace the contents with rows already sorted by Less
+    void assignSorted(const std::vector<Student>& sorted) {
+        clear();
+        for (std::size_t i = 0; i < sorted.size(); i += MAX_BLOCK / 2) {
+            std::size_t end = std::min(sorted.size(), i + MAX_BLOCK / 2);
+            blocks.emplace_back(sorted.begin() + i, sorted.begin() + end);
+        }
+        count = sorted.size();
+    }
+
+    void insert(const Student& s) {
+        if (blocks.empty()) {
+            blocks.push_back({s});
+            count = 1;
+            return;
+        }
+        std::size_t b = findBlock(s);
+        if (b == blocks.size()) --b; // larger than everything: append to the last block
+        std::vector<Student>& block = blocks[b];
+        block.insert(std::upper_bound(block.begin(), block.end(), s, less), s);
+        ++count;
+
+        if (block.size() > MAX_BLOCK) {
+            std::vector<Student> upper(std::make_move_iterator(block.begin() + block.size() / 2),
+                                       std::make_move_iterator(block.end()));
+            block.resize(block.size() / 2);
+            blocks.insert(blocks.begin() + b + 1, std::move(upper));
+        }
+    }
+
+    // Remove one element equivalent to s; false if there is none
+    bool erase(const Student& s) {
+        std::size_t b = findBlock(s);
+        if (b == blocks.size()) return false;
+        std::vector<Student>& block = blocks[b];
+        auto it = std::lower_bound(block.begin(), block.end(), s, less);
+        if (it == block.end() || less(s, *it)) return false;
+        block.erase(it);
+        --count;
+        if (block.empty()) blocks.erase(blocks.begin() + b);
+        return true;
+    }
+
+    template <typename Fn>
+    void forEach(Fn fn) const {
+        for (const auto& block : blocks)
+            for (const Student& s : block) fn(s);
+    }
+
+    // Visit elements not less than `from`, in order, until fn returns false
+    template <typename Fn>
+    void forRange(const Student& from, Fn fn) const {
+        std::size_t b = findBlock(from);
+        for (bool first = true; b < blocks.size(); ++b, first = false) {
+            const std::vector<Student>& block = blocks[b];
+            auto it = first ? std::lower_bound(block.begin(), block.end(), from, less) : block.begin();
+            for (; it != block.end(); ++it) {
+                if (!fn(*it)) return;
+            }
+        }
+    }
+};
+
+// --- Persistent ID / score indexes for one data file ---
+//
+// Saved as <data file>.idx together with the data file's size and
+// modification time; an index whose stamp does not match the data file is
+// considered stale and rebuilt from scratch.
+//
+// The file is one flat dump of both orders, so the O(log n + B) update cost
+// of SortedBlockList holds only in memory: every add/delete command loads the
+// whole index and writes it back (and delete also rewrites the data file),
+// which is O(n) I/O per mutation. What the index saves is the re-sort.
+class StudentIndex {
+private:
+    static constexpr char MAGIC[8] = {'S', 'T', 'U', 'I', 'D', 'X', '0', '1'};
+
+    SortedBlockList<IdLess> byId;
+    SortedBlockList<ScoreDescLess> byScore;
+
+    static bool dataStamp(const std::string& dataFile, uint64_t& size, int64_t& mtime) {
+        std::error_code ec;
+        size = std::filesystem::file_size(dataFile, ec);
+        if (ec) return false;
+        auto t = std::filesystem::last_write_time(dataFile, ec);
+        if (ec) return false;
+        mtime = static_cast<int64_t>(t.time_since_epoch().count());
+        return true;
+    }
+
+public:
+    static std::string pathFor(const std::string& dataFile) { return dataFile + ".idx"; }
+
+    std::size_t size() const { return byId.size(); }
+
+    // Full build: one sort per order
+    void build(std::vector<Student> rows) {
+        std::vector<Student> byScoreRows = rows;
+        if (rows.size() > 1) introSort(rows, 0, rows.size(), IdLess());
+        if (byScoreRows.size() > 1) introSort(byScoreRows, 0, byScoreRows.size(), ScoreDescLess());
+        byId.assignSorted(rows);
+        byScore.assignSorted(byScoreRows);
+    }
+
+    void insert(const Student& s) {
+        byId.insert(s);
+        byScore.insert(s);
+    }
+
+    // Remove every row with this ID, returning how many were removed
+    std::size_t removeId(const std::string& id) {
+        std::vector<Student> matches;
+        Student from{id, "", -std::numeric_limits<float>::infinity()};
+        byId.forRange(from, [&](const Student& s) {
+            if (s.id != id) return false;
+            matches.push_back(s);
+            return true;
+        });
+        for (const Student& s : matches) {
+            byId.erase(s);
+            byScore.erase(s);
+        }
+        return matches.size();
+    }
+
+    template <typename Fn>
+    void forEachById(Fn fn) const { byId.forEach(fn); }
+    template <typename Fn>
+    void forEachByScore(Fn fn) const { byScore.forEach(fn); }
+
+    bool save(const std::string& dataFile) const {
+        uint64_t size;
+        int64_t mtime;
+        if (!dataStamp(dataFile, size, mtime)) return false;
+        std::string path = pathFor(dataFile);
+        std::string tmp = path + ".tmp";
+        {
+            std::ofstream out(tmp, std::ios::binary);
+            if (!out) return false;
+            uint64_t rows = byId.size();
+            out.write(MAGIC, sizeof(MAGIC));
+            out.write(reinterpret_cast<const char*>(&size), sizeof(size));
+            out.write(reinterpret_cast<const char*>(&mtime), sizeof(mtime));
+            out.write(reinterpret_cast<const char*>(&rows), sizeof(rows));
+            byId.forEach([&out](const Student& s) { writeStudentRecord(out, s); });
+            byScore.forEach([&out](const Student& s) { writeStudentRecord(out, s); });
+            if (!out) return false;
+        }
+        // Replace atomically so a crash never leaves a half-written index
+        std::error_code ec;
+        std::filesystem::rename(tmp, path, ec);
+        return !ec;
+    }
+
+    // Load the index saved for dataFile; false if it is missing or stale
+    bool load(const std::string& dataFile) {
+        uint64_t size, savedSize;
+        int64_t mtime, savedMtime;
+        if (!dataStamp(dataFile, size, mtime)) return false;
+        std::ifstream in(pathFor(dataFile), std::ios::binary);
+        if (!in) return false;
+
+        char magic[8];
+        uint64_t rows = 0;
+        in.read(magic, sizeof(magic));
+        in.read(reinterpret_cast<char*>(&savedSize), sizeof(savedSize));
+        in.read(reinterpret_cast<char*>(&savedMtime), sizeof(savedMtime));
+        in.read(reinterpret_cast<char*>(&rows), sizeof(rows));
+        if (!in || std::memcmp(magic, MAGIC, sizeof(magic)) != 0) return false;
+        if (savedSize != size || savedMtime != mtime) return false;
+
+        std::vector<Student> sorted(rows);
+        for (auto& s : sorted)
+            if (!readStudentRecord(in, s)) return false;
+        byId.assignSorted(sorted);
+        for (auto& s : sorted)
+            if (!readStudentRecord(in, s)) return false;
+        byScore.assignSorted(sorted);
+        return true;
+    }
+};
+
+#endif // STUDENT_INDEX_H
@@ -0,0 +1,271 @@
+#ifndef STUDENT_LOADER_H
+#define STUDENT_LOADER_H
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <thread>
+#include <algorithm>
+#include "StudentTable.h"
+
+#include <fstream>
+#ifdef _WIN32
+#include <sstream>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// --- Read-only memory mapping of a whole file ---
+// (On Windows the file is simply read into memory.)
+class MappedFile {
+private:
+    const char* ptr = nullptr;
+    std::size_t length = 0;
+#ifdef _WIN32
+    std::string buffer;
+#endif
+
+public:
+    MappedFile() = default;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile() {
+#ifndef _WIN32
+        if (ptr != nullptr && length > 0) munmap(const_cast<char*>(ptr), length);
+#endif
+    }
+
+    bool open(const std::string& filename) {
+#ifdef _WIN32
+        std::ifstream in(filename, std::ios::binary);
+        if (!in) return false;
+        std::ostringstream ss;
+        ss << in.rdbuf();
+        buffer = ss.str();
+        ptr = buffer.data();
+        length = buffer.size();
+        return true;
+#else
+        int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            ::close(fd);
+            return false;
+        }
+        length = static_cast<std::size_t>(st.st_size);
+        if (length > 0) {
+            void* p = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED) {
+                ::close(fd);
+                length = 0;
+                return false;
+            }
+            madvise(p, length, MADV_SEQUENTIAL);
+            ptr = static_cast<const char*>(p);
+        }
+        ::close(fd);
+        return true;
+#endif
+    }
+
+    const char* data() const { return ptr; }
+    std::size_t size() const { return length; }
+};
+
+// --- Hand-written tokenizer for "ID Name Score" lines ---
+
+struct ParsedRow {
+    std::size_t idStart;
+    uint32_t idLength;
+    std::string_view name;
+    float score;
+};
+
+struct ParseError {
+    std::size_t line; // 1-based within the parsed chunk until rebased
+    std::string_view text;
+};
+
+struct ParsedChunk {
+    std::vector<ParsedRow> rows;
+    std::vector<ParseError> errors;
+    std::size_t lines = 0;
+};
+
+inline bool isBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+enum LineStatus { LINE_BLANK, LINE_OK, LINE_MALFORMED };
+
+// Split one line into its ID, name and score fields
+inline LineStatus parseStudentLine(std::string_view line, std::string_view& id, std::string_view& name, float& score) {
+    std::string_view tokens[3];
+    int count = 0;
+    std::size_t p = 0;
+    while (count < 3) {
+        while (p < line.size() && isBlank(line[p])) ++p;
+        if (p == line.size()) break;
+        std::size_t q = p;
+        while (q < line.size() && !isBlank(line[q])) ++q;
+        tokens[count++] = line.substr(p, q - p);
+        p = q;
+    }
+    if (count == 0) return LINE_BLANK;
+    if (count < 3) return LINE_MALFORMED;
+
+    const char* first = tokens[2].data();
+    const char* last = first + tokens[2].size();
+    if (*first == '+') ++first; // accepted by operator>>, not by from_chars
+    std::from_chars_result r = std::from_chars(first, last, score);
+    // from_chars also takes "nan" and "inf", which operator>> rejects and
+    // which no score comparison or histogram bin can handle
+    if (r.ec != std::errc() || r.ptr != last || !std::isfinite(score)) return LINE_MALFORMED;
+    id = tokens[0];
+    name = tokens[1];
+    return LINE_OK;
+}
+
+// Parse data[begin, end), which must start at a line boundary
+inline void parseStudentChunk(const char* data, std::size_t begin, std::size_t end, ParsedChunk& out) {
+    std::size_t pos = begin;
+    while (pos < end) {
+        std::size_t lineEnd = pos;
+        while (lineEnd < end && data[lineEnd] != '\n') ++lineEnd;
+        ++out.lines;
+
+        std::string_view line(data + pos, lineEnd - pos);
+        std::string_view id, name;
+        float score = 0.0f;
+        LineStatus status = parseStudentLine(line, id, name, score);
+        if (status == LINE_OK) {
+            out.rows.push_back({static_cast<std::size_t>(id.data() - data), static_cast<uint32_t>(id.size()), name, score});
+        } else if (status == LINE_MALFORMED) {
+            out.errors.push_back({out.lines, line});
+        }
+        pos = lineEnd + 1;
+    }
+}
+
+// Stream "ID Name Score" lines from `filename` without loading the whole file,
+// calling onRow(id, name, score) for every valid line. The views are only
+// valid during the call. Malformed lines are reported on stderr unless
+// reportMalformed is false (for a second pass over the same file).
+template <typename OnRow>
+bool streamStudentFile(const std::string& filename, OnRow onRow, bool reportMalformed = true) {
+    std::ifstream infile(filename);
+    if (!infile.is_open()) {
+        std::cerr << "Error opening file: " << filename << std::endl;
+        return false;
+    }
+    std::string line;
+    std::size_t lineNo = 0;
+    while (std::getline(infile, line)) {
+        ++lineNo;
+        std::string_view id, name;
+        float score = 0.0f;
+        LineStatus status = parseStudentLine(line, id, name, score);
+        if (status == LINE_OK) {
+            onRow(id, name, score);
+        } else if (status == LINE_MALFORMED && reportMalformed) {
+            std::cerr << filename << ":" << lineNo << ": malformed line: " << line << std::endl;
+        }
+    }
+    return true;
+}
+
+// Stream the raw lines of `filename` with the ID of each valid row
+// (malformed lines get an empty ID), for rewriting the file in place
+template <typename OnLine>
+bool streamStudentLines(const std::string& filename, OnLine onLine) {
+    std::ifstream infile(filename);
+    if (!infile.is_open()) {
+        std::cerr << "Error opening file: " << filename << std::endl;
+        return false;
+    }
+    std::string line;
+    while (std::getline(infile, line)) {
+        std::string_view id, name;
+        float score = 0.0f;
+        LineStatus status = parseStudentLine(line, id, name, score);
+        if (status == LINE_BLANK) continue;
+        onLine(line, status == LINE_OK ? id : std::string_view());
+    }
+    return true;
+}
+
+// Memory-map `filename` and load it into `table`. IDs are borrowed from the
+// mapping (no per-row copies or allocations); names are interned. With
+// threads > 1 the file is cut at newline boundaries and the chunks are
+// tokenized in parallel. Malformed lines are reported on stderr with their
+// line numbers and skipped.
+inline bool loadStudentTableMapped(StudentTable& table, const std::string& filename, unsigned threads = 1) {
+    std::shared_ptr<MappedFile> file = std::make_shared<MappedFile>();
+    if (!file->open(filename)) {
+        std::cerr << "Error opening file: " << filename << std::endl;
+        return false;
+    }
+    const char* data = file->data();
+    std::size_t size = file->size();
+
+    // Chunk boundaries, each moved forward to just past a newline
+    std::size_t parts = threads > 1 ? threads : 1;
+    if (size < (std::size_t(1) << 20)) parts = 1;
+    std::vector<std::size_t> bounds(parts + 1, size);
+    bounds[0] = 0;
+    for (std::size_t c = 1; c < parts; ++c) {
+        std::size_t b = std::max(bounds[c - 1], size * c / parts);
+        while (b < size && data[b - 1] != '\n') ++b;
+        bounds[c] = b;
+    }
+
+    std::vector<ParsedChunk> chunks(parts);
+    if (parts == 1) {
+        parseStudentChunk(data, 0, size, chunks[0]);
+    } else {
+        std::vector<std::thread> workers;
+        for (std::size_t c = 0; c < parts; ++c) {
+            workers.emplace_back([&, c] { parseStudentChunk(data, bounds[c], bounds[c + 1], chunks[c]); });
+        }
+        for (auto& t : workers) t.join();
+    }
+
+    // Borrowed IDs are addressed with 32-bit offsets; larger files are copied
+    bool borrow = size <= UINT32_MAX;
+    std::size_t rows = 0;
+    for (const auto& chunk : chunks) rows += chunk.rows.size();
+    if (borrow) {
+        table.attachIdSource(data, file);
+    } else {
+        table.clear();
+    }
+    table.reserve(rows, borrow ? 0 : size);
+
+    std::size_t lineBase = 0;
+    for (const auto& chunk : chunks) {
+        for (const ParseError& e : chunk.errors) {
+            std::cerr << filename << ":" << (lineBase + e.line) << ": malformed line: " << e.text << std::endl;
+        }
+        for (const ParsedRow& r : chunk.rows) {
+            if (borrow) {
+                table.addBorrowed(static_cast<uint32_t>(r.idStart), r.idLength, r.name, r.score);
+            } else {
+                table.add(std::string_view(data + r.idStart, r.idLength), r.name, r.score);
+            }
+        }
+        lineBase += chunk.lines;
+    }
+    return true;
+}
+
+#endif // STUDENT_LOADER_H
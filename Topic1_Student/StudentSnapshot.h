@@ -0,0 +1,304 @@
+#ifndef STUDENT_SNAPSHOT_H
+#define STUDENT_SNAPSHOT_H
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <cstring>
+#include "StudentTable.h"
+#include "StudentLoader.h"
+
+// --- Binary columnar snapshot ---
+//
+// Layout (host byte order, every section 8-byte aligned):
+//
+//   SnapshotHeader
+//   float    scores[rows]
+//   uint32_t idOffsets[rows + 1]      row r's ID is idBytes[idOffsets[r], idOffsets[r+1])
+//   char     idBytes[...]
+//   uint32_t nameRef[rows]            index into the name pool
+//   uint32_t nameOffsets[names + 1]
+//   char     nameBytes[...]
+//   uint32_t idOrder[rows]            optional: sort_id permutation
+//   uint32_t scoreOrder[rows]         optional: sort_score permutation
+//
+// A snapshot is opened with mmap and served in place: nothing is parsed and
+// nothing is allocated per row. Snapshots are immutable, so the stored
+// permutations stay valid for the file's whole life. Opening checks every
+// section, offset table and stored permutation against the file size, so a
+// truncated or edited snapshot is rejected instead of read past the end of
+// the mapping.
+
+const char SNAPSHOT_MAGIC[8] = {'S', 'T', 'U', 'S', 'N', 'A', 'P', '1'};
+const uint32_t SNAPSHOT_VERSION = 1;
+const uint32_t SNAPSHOT_HAS_ID_ORDER = 1u << 0;
+const uint32_t SNAPSHOT_HAS_SCORE_ORDER = 1u << 1;
+
+struct SnapshotHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t flags;
+    uint64_t rows;
+    uint64_t names;
+    uint64_t scoresOffset;
+    uint64_t idOffsetsOffset;
+    uint64_t idBytesOffset;
+    uint64_t nameRefOffset;
+    uint64_t nameOffsetsOffset;
+    uint64_t nameBytesOffset;
+    uint64_t idOrderOffset;
+    uint64_t scoreOrderOffset;
+    uint64_t fileSize;
+};
+
+// Write `table` as a snapshot; with withOrders the sort_id and sort_score
+// permutations are computed once and stored too
+inline bool writeStudentSnapshot(const StudentTable& table, const std::string& path, bool withOrders) {
+    std::ofstream out(path, std::ios::binary);
+    if (!out) {
+        std::cerr << "Error opening file for writing: " << path << std::endl;
+        return false;
+    }
+
+    uint64_t rows = table.size();
+    uint64_t names = table.distinctNames();
+    uint64_t idBytes = 0, nameBytes = 0;
+    for (uint64_t r = 0; r < rows; ++r) idBytes += table.id(static_cast<uint32_t>(r)).size();
+    for (uint64_t i = 0; i < names; ++i) nameBytes += table.distinctName(static_cast<uint32_t>(i)).size();
+    if (idBytes > UINT32_MAX || nameBytes > UINT32_MAX) {
+        std::cerr << "Snapshot pools exceed 4 GiB" << std::endl;
+        return false;
+    }
+
+    auto align8 = [](uint64_t x) { return (x + 7) & ~uint64_t(7); };
+    SnapshotHeader h;
+    std::memset(&h, 0, sizeof(h));
+    std::memcpy(h.magic, SNAPSHOT_MAGIC, sizeof(h.magic));
+    h.version = SNAPSHOT_VERSION;
+    h.flags = withOrders ? (SNAPSHOT_HAS_ID_ORDER | SNAPSHOT_HAS_SCORE_ORDER) : 0;
+    h.rows = rows;
+    h.names = names;
+    h.scoresOffset = align8(sizeof(SnapshotHeader));
+    h.idOffsetsOffset = align8(h.scoresOffset + rows * sizeof(float));
+    h.idBytesOffset = align8(h.idOffsetsOffset + (rows + 1) * sizeof(uint32_t));
+    h.nameRefOffset = align8(h.idBytesOffset + idBytes);
+    h.nameOffsetsOffset = align8(h.nameRefOffset + rows * sizeof(uint32_t));
+    h.nameBytesOffset = align8(h.nameOffsetsOffset + (names + 1) * sizeof(uint32_t));
+    uint64_t end = align8(h.nameBytesOffset + nameBytes);
+    if (withOrders) {
+        h.idOrderOffset = end;
+        h.scoreOrderOffset = align8(h.idOrderOffset + rows * sizeof(uint32_t));
+        end = align8(h.scoreOrderOffset + rows * sizeof(uint32_t));
+    }
+    h.fileSize = end;
+
+    uint64_t written = 0;
+    auto padTo = [&](uint64_t offset) {
+        static const char zeros[8] = {0};
+        out.write(zeros, static_cast<std::streamsize>(offset - written));
+        written = offset;
+    };
+    auto put = [&](const void* p, uint64_t bytes) {
+        out.write(static_cast<const char*>(p), static_cast<std::streamsize>(bytes));
+        written += bytes;
+    };
+    auto putU32 = [&](uint32_t v) { put(&v, sizeof(v)); };
+
+    put(&h, sizeof(h));
+
+    padTo(h.scoresOffset);
+    for (uint64_t r = 0; r < rows; ++r) {
+        float s = table.score(static_cast<uint32_t>(r));
+        put(&s, sizeof(s));
+    }
+
+    padTo(h.idOffsetsOffset);
+    uint32_t offset = 0;
+    putU32(0);
+    for (uint64_t r = 0; r < rows; ++r) {
+        offset += static_cast<uint32_t>(table.id(static_cast<uint32_t>(r)).size());
+        putU32(offset);
+    }
+    padTo(h.idBytesOffset);
+    for (uint64_t r = 0; r < rows; ++r) {
+        std::string_view id = table.id(static_cast<uint32_t>(r));
+        put(id.data(), id.size());
+    }
+
+    padTo(h.nameRefOffset);
+    for (uint64_t r = 0; r < rows; ++r) putU32(table.nameIndex(static_cast<uint32_t>(r)));
+    padTo(h.nameOffsetsOffset);
+    offset = 0;
+    putU32(0);
+    for (uint64_t i = 0; i < names; ++i) {
+        offset += static_cast<uint32_t>(table.distinctName(static_cast<uint32_t>(i)).size());
+        putU32(offset);
+    }
+    padTo(h.nameBytesOffset);
+    for (uint64_t i = 0; i < names; ++i) {
+        std::string_view name = table.distinctName(static_cast<uint32_t>(i));
+        put(name.data(), name.size());
+    }
+
+    if (withOrders) {
+        std::vector<uint32_t> order = table.orderById();
+        padTo(h.idOrderOffset);
+        put(order.data(), order.size() * sizeof(uint32_t));
+        order = table.orderByScoreDesc();
+        padTo(h.scoreOrderOffset);
+        put(order.data(), order.size() * sizeof(uint32_t));
+    }
+    padTo(h.fileSize);
+    return static_cast<bool>(out);
+}
+
+// Read-only view of a mapped snapshot
+class StudentSnapshot {
+private:
+    std::shared_ptr<MappedFile> file;
+    const SnapshotHeader* header = nullptr;
+    const float* scores = nullptr;
+    const uint32_t* idOffsets = nullptr;
+    const char* idBytes = nullptr;
+    const uint32_t* nameRef = nullptr;
+    const uint32_t* nameOffsets = nullptr;
+    const char* nameBytes = nullptr;
+
+    template <typename T>
+    const T* at(uint64_t offset) const {
+        return reinterpret_cast<const T*>(file->data() + offset);
+    }
+
+    // A section of count elements of elemSize bytes at offset, aligned and
+    // inside the file (compared by division so a huge count cannot overflow)
+    bool fits(uint64_t offset, uint64_t count, uint64_t elemSize) const {
+        uint64_t fileSize = file->size();
+        return offset % elemSize == 0 && offset >= sizeof(SnapshotHeader) && offset <= fileSize &&
+               count <= (fileSize - offset) / elemSize;
+    }
+
+    // Offset table of count + 1 entries: starts at 0, never decreases and
+    // ends inside the file for a pool starting at poolOffset
+    bool validOffsets(const uint32_t* offsets, uint64_t count, uint64_t poolOffset) const {
+        if (offsets[0] != 0 || poolOffset > file->size() || offsets[count] > file->size() - poolOffset) return false;
+        for (uint64_t i = 0; i < count; ++i) {
+            if (offsets[i + 1] < offsets[i]) return false;
+        }
+        return true;
+    }
+
+    // A stored permutation must only name existing rows
+    bool validOrder(uint64_t offset) const {
+        if (!fits(offset, header->rows, sizeof(uint32_t))) return false;
+        const uint32_t* order = at<uint32_t>(offset);
+        for (uint64_t i = 0; i < header->rows; ++i) {
+            if (order[i] >= header->rows) return false;
+        }
+        return true;
+    }
+
+    // Check every section against the file size before anything is read
+    // through it: a truncated or edited snapshot is rejected, never read past
+    // the end of the mapping. One sequential pass over the offset tables.
+    bool validLayout() const {
+        const SnapshotHeader& h = *header;
+        if (h.rows >= UINT32_MAX || h.names >= UINT32_MAX) return false;
+        if (!fits(h.scoresOffset, h.rows, sizeof(float)) || !fits(h.idOffsetsOffset, h.rows + 1, sizeof(uint32_t)) ||
+            !fits(h.nameRefOffset, h.rows, sizeof(uint32_t)) ||
+            !fits(h.nameOffsetsOffset, h.names + 1, sizeof(uint32_t))) {
+            return false;
+        }
+        if (!validOffsets(at<uint32_t>(h.idOffsetsOffset), h.rows, h.idBytesOffset) ||
+            !validOffsets(at<uint32_t>(h.nameOffsetsOffset), h.names, h.nameBytesOffset)) {
+            return false;
+        }
+        const uint32_t* refs = at<uint32_t>(h.nameRefOffset);
+        for (uint64_t r = 0; r < h.rows; ++r) {
+            if (refs[r] >= h.names) return false;
+        }
+        if ((h.flags & SNAPSHOT_HAS_ID_ORDER) && !validOrder(h.idOrderOffset)) return false;
+        if ((h.flags & SNAPSHOT_HAS_SCORE_ORDER) && !validOrder(h.scoreOrderOffset)) return false;
+        return true;
+    }
+
+public:
+    // True if the file starts with the snapshot magic
+    static bool isSnapshot(const std::string& path) {
+        std::ifstream in(path, std::ios::binary);
+        char magic[8] = {0};
+        return in.read(magic, sizeof(magic)) && std::memcmp(magic, SNAPSHOT_MAGIC, sizeof(magic)) == 0;
+    }
+
+    bool open(const std::string& path) {
+        file = std::make_shared<MappedFile>();
+        if (!file->open(path)) {
+            std::cerr << "Error opening file: " << path << std::endl;
+            return false;
+        }
+        if (file->size() < sizeof(SnapshotHeader)) {
+            std::cerr << "Corrupt snapshot: " << path << std::endl;
+            return false;
+        }
+        header = at<SnapshotHeader>(0);
+        const SnapshotHeader& h = *header;
+        if (std::memcmp(h.magic, SNAPSHOT_MAGIC, sizeof(h.magic)) != 0 || h.version != SNAPSHOT_VERSION ||
+            h.fileSize != file->size() || !validLayout()) {
+            std::cerr << "Corrupt snapshot: " << path << std::endl;
+            return false;
+        }
+        scores = at<float>(h.scoresOffset);
+        idOffsets = at<uint32_t>(h.idOffsetsOffset);
+        idBytes = at<char>(h.idBytesOffset);
+        nameRef = at<uint32_t>(h.nameRefOffset);
+        nameOffsets = at<uint32_t>(h.nameOffsetsOffset);
+        nameBytes = at<char>(h.nameBytesOffset);
+        return true;
+    }
+
+    std::size_t size() const { return static_cast<std::size_t>(header->rows); }
+
+    std::string_view id(uint32_t row) const {
+        return std::string_view(idBytes + idOffsets[row], idOffsets[row + 1] - idOffsets[row]);
+    }
+    std::string_view name(uint32_t row) const {
+        uint32_t n = nameRef[row];
+        return std::string_view(nameBytes + nameOffsets[n], nameOffsets[n + 1] - nameOffsets[n]);
+    }
+    float score(uint32_t row) const { return scores[row]; }
+    const float* scoreData() const { return scores; }
+
+    // Stored permutations, or nullptr if the snapshot was written without them
+    const uint32_t* idOrder() const {
+        return (header->flags & SNAPSHOT_HAS_ID_ORDER) ? at<uint32_t>(header->idOrderOffset) : nullptr;
+    }
+    const uint32_t* scoreOrder() const {
+        return (header->flags & SNAPSHOT_HAS_SCORE_ORDER) ? at<uint32_t>(header->scoreOrderOffset) : nullptr;
+    }
+
+    // Copy into a StudentTable (IDs borrowed from the mapping), for operations
+    // that need to sort
+    StudentTable toTable() const {
+        StudentTable table;
+        table.attachIdSource(idBytes, file);
+        table.reserve(size(), 0);
+        for (uint32_t r = 0; r < size(); ++r)
+            table.addBorrowed(idOffsets[r], idOffsets[r + 1] - idOffsets[r], name(r), scores[r]);
+        return table;
+    }
+
+    // CSV in the same format as printStudentsCSV, rows visited in `order`
+    void printCSV(std::ostream& out, const uint32_t* order) const {
+        out << "id,name,score\n";
+        for (std::size_t i = 0; i < size(); ++i) {
+            uint32_t r = order[i];
+            out << id(r) << ',' << name(r) << ',' << scores[r] << '\n';
+        }
+        out.flush();
+    }
+};
+
+#endif // STUDENT_SNAPSHOT_H
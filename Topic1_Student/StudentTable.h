@@ -0,0 +1,227 @@
+#ifndef STUDENT_TABLE_H
+#define STUDENT_TABLE_H
+
+#include <vector>
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include <ostream>
+#include <memory>
+#include "Student.h"
+#include "Sort.h"
+
+// Columnar (structure-of-arrays) student store.
+//
+//   idPool             : ID bytes, owned here or borrowed from a mapped file
+//   idStart / idLength : row r's ID is idPool[idStart[r], idStart[r] + idLength[r])
+//   idPrefix           : first 8 ID bytes packed big-endian, compared before the full key
+//   scores             : one float per row
+//   namePool / nameRef : distinct names interned once, rows refer to them by index
+//
+// Sorting never moves rows; it produces a 32-bit index permutation that the
+// printers walk in order.
+class StudentTable {
+private:
+    std::string idPool;
+    const char* externalIds = nullptr;          // borrowed ID bytes (see attachIdSource)
+    std::shared_ptr<const void> externalOwner;  // keeps the borrowed bytes alive
+    std::vector<uint32_t> idStart;
+    std::vector<uint32_t> idLength;
+    std::vector<uint64_t> idPrefix;
+    std::vector<float> scores;
+
+    std::string namePool;
+    std::vector<uint32_t> nameOffset{0};
+    std::vector<uint32_t> nameRef;
+    std::vector<uint32_t> nameSlots; // open addressing: name index + 1, 0 = empty
+
+    static uint64_t hashName(std::string_view s) {
+        uint64_t h = 1469598103934665603ull; // FNV-1a
+        for (char c : s) {
+            h ^= static_cast<unsigned char>(c);
+            h *= 1099511628211ull;
+        }
+        return h;
+    }
+
+    void growNameSlots() {
+        std::vector<uint32_t> old;
+        old.swap(nameSlots);
+        nameSlots.assign(old.empty() ? 64 : old.size() * 2, 0);
+        std::size_t mask = nameSlots.size() - 1;
+        for (uint32_t slot : old) {
+            if (slot == 0) continue;
+            std::size_t i = hashName(nameAt(slot - 1)) & mask;
+            while (nameSlots[i] != 0) i = (i + 1) & mask;
+            nameSlots[i] = slot;
+        }
+    }
+
+    std::string_view nameAt(uint32_t nameIndex) const {
+        return std::string_view(namePool.data() + nameOffset[nameIndex],
+                                nameOffset[nameIndex + 1] - nameOffset[nameIndex]);
+    }
+
+    uint32_t internName(std::string_view name) {
+        std::size_t distinct = nameOffset.size() - 1;
+        if ((distinct + 1) * 2 > nameSlots.size()) growNameSlots();
+        std::size_t mask = nameSlots.size() - 1;
+        std::size_t i = hashName(name) & mask;
+        while (nameSlots[i] != 0) {
+            if (nameAt(nameSlots[i] - 1) == name) return nameSlots[i] - 1;
+            i = (i + 1) & mask;
+        }
+        uint32_t index = static_cast<uint32_t>(distinct);
+        namePool.append(name.data(), name.size());
+        nameOffset.push_back(static_cast<uint32_t>(namePool.size()));
+        nameSlots[i] = index + 1;
+        return index;
+    }
+
+    const char* idData() const { return externalIds ? externalIds : idPool.data(); }
+
+    void pushRow(uint32_t start, std::string_view id, std::string_view name, float score) {
+        idStart.push_back(start);
+        idLength.push_back(static_cast<uint32_t>(id.size()));
+        idPrefix.push_back(packStringPrefix(id));
+        scores.push_back(score);
+        nameRef.push_back(internName(name));
+    }
+
+public:
+    void clear() {
+        idPool.clear();
+        externalIds = nullptr;
+        externalOwner.reset();
+        idStart.clear();
+        idLength.clear();
+        idPrefix.clear();
+        scores.clear();
+        namePool.clear();
+        nameOffset.assign(1, 0);
+        nameRef.clear();
+        nameSlots.clear();
+    }
+
+    void reserve(std::size_t rows, std::size_t idBytes) {
+        idPool.reserve(idBytes);
+        idStart.reserve(rows);
+        idLength.reserve(rows);
+        idPrefix.reserve(rows);
+        scores.reserve(rows);
+        nameRef.reserve(rows);
+    }
+
+    // Append a row, copying the ID bytes into the table
+    void add(std::string_view id, std::string_view name, float score) {
+        uint32_t start = static_cast<uint32_t>(idPool.size());
+        idPool.append(id.data(), id.size());
+        pushRow(start, id, name, score);
+    }
+
+    // Borrow ID bytes from `base` (e.g. a memory-mapped file) instead of copying
+    // them; `owner` keeps that memory alive. Only valid on an empty table, after
+    // which rows are added with addBorrowed.
+    void attachIdSource(const char* base, std::shared_ptr<const void> owner) {
+        clear();
+        externalIds = base;
+        externalOwner = std::move(owner);
+    }
+
+    // Append a row whose ID is base[start, start + length) of the attached source
+    void addBorrowed(uint32_t start, uint32_t length, std::string_view name, float score) {
+        pushRow(start, std::string_view(externalIds + start, length), name, score);
+    }
+
+    static StudentTable fromStudents(const std::vector<Student>& students) {
+        StudentTable table;
+        std::size_t idBytes = 0;
+        for (const auto& s : students) idBytes += s.id.size();
+        table.reserve(students.size(), idBytes);
+        for (const auto& s : students) table.add(s.id, s.name, s.score);
+        return table;
+    }
+
+    std::size_t size() const { return scores.size(); }
+    std::size_t distinctNames() const { return nameOffset.size() - 1; }
+
+    std::string_view id(uint32_t row) const {
+        return std::string_view(idData() + idStart[row], idLength[row]);
+    }
+    std::string_view name(uint32_t row) const { return nameAt(nameRef[row]); }
+    float score(uint32_t row) const { return scores[row]; }
+    const float* scoreData() const { return scores.data(); }
+
+    // Interned name pool, for serialisation
+    uint32_t nameIndex(uint32_t row) const { return nameRef[row]; }
+    std::string_view distinctName(uint32_t nameIndex) const { return nameAt(nameIndex); }
+
+    Student row(uint32_t r) const {
+        return {std::string(id(r)), std::string(name(r)), score(r)};
+    }
+
+    // Same ordering as std::string comparison of the IDs
+    int compareId(uint32_t a, uint32_t b) const {
+        if (idPrefix[a] != idPrefix[b]) return idPrefix[a] < idPrefix[b] ? -1 : 1;
+        std::size_t lenA = idLength[a];
+        std::size_t lenB = idLength[b];
+        if (lenA <= 8 && lenB <= 8) return lenA == lenB ? 0 : (lenA < lenB ? -1 : 1);
+        return id(a).compare(id(b));
+    }
+
+    int compareName(uint32_t a, uint32_t b) const {
+        if (nameRef[a] == nameRef[b]) return 0;
+        return name(a).compare(name(b));
+    }
+
+    // Row orderings matching IdLess / ScoreDescLess in Sort.h
+    struct IdOrder {
+        const StudentTable* t;
+        bool operator()(uint32_t a, uint32_t b) const {
+            int c = t->compareId(a, b);
+            if (c != 0) return c < 0;
+            c = t->compareName(a, b);
+            if (c != 0) return c < 0;
+            return t->scores[a] < t->scores[b];
+        }
+    };
+
+    struct ScoreDescOrder {
+        const StudentTable* t;
+        bool operator()(uint32_t a, uint32_t b) const {
+            if (t->scores[a] != t->scores[b]) return t->scores[a] > t->scores[b];
+            int c = t->compareId(a, b);
+            if (c != 0) return c < 0;
+            return t->compareName(a, b) < 0;
+        }
+    };
+
+    std::vector<uint32_t> identityOrder() const {
+        std::vector<uint32_t> order(size());
+        for (std::size_t i = 0; i < order.size(); ++i) order[i] = static_cast<uint32_t>(i);
+        return order;
+    }
+
+    std::vector<uint32_t> orderById() const {
+        std::vector<uint32_t> order = identityOrder();
+        if (order.size() > 1) introSort(order, 0, order.size(), IdOrder{this});
+        return order;
+    }
+
+    std::vector<uint32_t> orderByScoreDesc() const {
+        std::vector<uint32_t> order = identityOrder();
+        if (order.size() > 1) introSort(order, 0, order.size(), ScoreDescOrder{this});
+        return order;
+    }
+
+    // CSV in the same format as printStudentsCSV, rows visited in `order`
+    void printCSV(std::ostream& out, const std::vector<uint32_t>& order) const {
+        out << "id,name,score\n";
+        for (uint32_t r : order) {
+            out << id(r) << ',' << name(r) << ',' << scores[r] << '\n';
+        }
+        out.flush();
+    }
+};
+
+#endif // STUDENT_TABLE_H
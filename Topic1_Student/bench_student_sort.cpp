@@ -0,0 +1,185 @@
+// Sort benchmark for the Student grade system.
+//
+// Usage: bench_student_sort [max_rows] [--threads N]
+//
+// Generates rosters of 1K, 10K, ... up to max_rows (default 1,000,000) in
+// several shapes, runs every sort variant on a fresh copy and prints one CSV
+// row per (distribution, rows, algorithm) with wall time, throughput and, for
+// the single-threaded comparison sorts, comparison and element-move counts
+// (one swap is three moves).
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <random>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <algorithm>
+#include <functional>
+#include "Student.h"
+#include "Sort.h"
+#include "RadixSort.h"
+#include "ParallelSort.h"
+#include "StudentTable.h"
+#include "KeySort.h"
+
+using namespace std;
+
+// --- Instrumentation ---
+
+static unsigned long long g_comparisons = 0;
+static unsigned long long g_moves = 0;
+
+// Student whose copies and moves are counted
+struct CountedStudent : Student {
+    CountedStudent() = default;
+    CountedStudent(const Student& s) : Student(s) {}
+    CountedStudent(const CountedStudent& o) : Student(o) { ++g_moves; }
+    CountedStudent(CountedStudent&& o) noexcept : Student(std::move(o)) { ++g_moves; }
+    CountedStudent& operator=(const CountedStudent& o) {
+        Student::operator=(o);
+        ++g_moves;
+        return *this;
+    }
+    CountedStudent& operator=(CountedStudent&& o) noexcept {
+        Student::operator=(std::move(o));
+        ++g_moves;
+        return *this;
+    }
+};
+
+template <typename Less>
+struct CountingLess {
+    Less less;
+    bool operator()(const Student& a, const Student& b) const {
+        ++g_comparisons;
+        return less(a, b);
+    }
+};
+
+// --- Roster generators ---
+
+string fixedWidthId(unsigned long long v, int width) {
+    string s = to_string(v);
+    return string(width > static_cast<int>(s.size()) ? width - s.size() : 0, '0') + s;
+}
+
+vector<Student> generateRoster(const string& shape, size_t n, mt19937_64& rng) {
+    vector<Student> rows(n);
+    uniform_int_distribution<unsigned long long> idDist(0, 9999999999ULL);
+    uniform_int_distribution<int> scoreDist(0, 1000);
+    uniform_int_distribution<int> coarseDist(0, 10);
+    for (size_t i = 0; i < n; ++i) {
+        Student& s = rows[i];
+        s.name = "N" + to_string(i % 997);
+        if (shape == "random") {
+            s.id = fixedWidthId(idDist(rng), 10);
+            s.score = scoreDist(rng) / 10.0f;
+        } else if (shape == "sorted") {
+            // ID ascending and score descending: already in both output orders
+            s.id = fixedWidthId(i, 10);
+            s.score = 100.0f - static_cast<float>(i) * 100.0f / static_cast<float>(n);
+        } else if (shape == "reverse") {
+            s.id = fixedWidthId(n - i, 10);
+            s.score = static_cast<float>(i) * 100.0f / static_cast<float>(n);
+        } else if (shape == "dup_scores") {
+            s.id = fixedWidthId(idDist(rng), 10);
+            s.score = coarseDist(rng) * 10.0f;
+        } else { // shared_prefix
+            s.id = "2024-CS-STUDENT-" + fixedWidthId(idDist(rng) % 100000000ULL, 8);
+            s.score = scoreDist(rng) / 10.0f;
+        }
+    }
+    return rows;
+}
+
+// --- Runner ---
+
+void report(const string& shape, size_t n, const string& algo, double seconds, bool counted) {
+    double rate = seconds > 0 ? n / seconds : 0;
+    printf("%s,%zu,%s,%.6f,%.0f,", shape.c_str(), n, algo.c_str(), seconds, rate);
+    if (counted) {
+        printf("%llu,%llu\n", g_comparisons, g_moves);
+    } else {
+        printf(",\n");
+    }
+    fflush(stdout);
+}
+
+double timeIt(const function<void()>& fn) {
+    auto start = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+// Run one counted comparison sort on a CountedStudent copy of rows
+void runCounted(const string& shape, const string& algo, const vector<Student>& rows,
+                const function<void(vector<CountedStudent>&)>& sortFn) {
+    vector<CountedStudent> data(rows.begin(), rows.end());
+    g_comparisons = 0;
+    g_moves = 0;
+    double t = timeIt([&] { sortFn(data); });
+    report(shape, rows.size(), algo, t, true);
+}
+
+int main(int argc, char* argv[]) {
+    size_t maxRows = 1000000;
+    unsigned threads = max(1u, thread::hardware_concurrency());
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (arg == "--threads" && i + 1 < argc) {
+            threads = max(1, atoi(argv[++i]));
+        } else {
+            maxRows = strtoull(argv[i], nullptr, 10);
+        }
+    }
+
+    const vector<string> shapes = {"random", "sorted", "reverse", "dup_scores", "shared_prefix"};
+    mt19937_64 rng(20240601);
+
+    printf("distribution,rows,algorithm,seconds,rows_per_sec,comparisons,moves\n");
+    for (size_t n = 1000; n <= maxRows; n *= 10) {
+        for (const string& shape : shapes) {
+            vector<Student> rows = generateRoster(shape, n, rng);
+
+            runCounted(shape, "quickSort_id", rows, [](vector<CountedStudent>& a) {
+                if (a.size() > 1) introSort(a, 0, a.size(), CountingLess<IdLess>());
+            });
+            runCounted(shape, "std_sort_id", rows, [](vector<CountedStudent>& a) {
+                sort(a.begin(), a.end(), CountingLess<IdLess>());
+            });
+            runCounted(shape, "heapSort_score", rows, [](vector<CountedStudent>& a) {
+                heapSort(a, CountingLess<ScoreDescLess>());
+            });
+            runCounted(shape, "std_sort_score", rows, [](vector<CountedStudent>& a) {
+                sort(a.begin(), a.end(), CountingLess<ScoreDescLess>());
+            });
+
+            double t = timeIt([&] { radixOrderById(rows); });
+            report(shape, n, "radix_id", t, false);
+            t = timeIt([&] { radixOrderByScoreDesc(rows); });
+            report(shape, n, "radix_score", t, false);
+
+            t = timeIt([&] { IdKeys::order(rows); });
+            report(shape, n, "keys_id", t, false);
+            t = timeIt([&] { ScoreIdKeys::order(rows); });
+            report(shape, n, "keys_score", t, false);
+
+            vector<Student> copy = rows;
+            t = timeIt([&] { parallelSort(copy, threads, IdLess()); });
+            report(shape, n, "parallel_id_x" + to_string(threads), t, false);
+            copy = rows;
+            t = timeIt([&] { parallelSort(copy, threads, ScoreDescLess()); });
+            report(shape, n, "parallel_score_x" + to_string(threads), t, false);
+
+            StudentTable table = StudentTable::fromStudents(rows);
+            t = timeIt([&] { table.orderById(); });
+            report(shape, n, "columnar_id", t, false);
+            t = timeIt([&] { table.orderByScoreDesc(); });
+            report(shape, n, "columnar_score", t, false);
+        }
+    }
+    return 0;
+}
@@ -4,75 +4,24 @@
 #include <string>
 #include <fstream>
 #include <sstream>
+#include <cstdlib>
+#include <string_view>
+#include <filesystem>
 #include "Student.h"
+#include "Sort.h"
+#include "RadixSort.h"
+#include "ParallelSort.h"
+#include "StudentTable.h"
+#include "StudentLoader.h"
+#include "ExternalSort.h"
+#include "Ranking.h"
+#include "StudentSnapshot.h"
+#include "GradeStats.h"
+#include "StudentIndex.h"
+#include "KeySort.h"
 
 using namespace std;
 
-// --- QuickSort Implementation (Ascending by ID) ---
-
-int partition(vector<Student>& students, int low, int high) {
-    string pivot = students[high].id;
-    int i = (low - 1);
-
-    for (int j = low; j <= high - 1; j++) {
-        // Ascending order: if current element is smaller than pivot, increment i and swap
-        if (students[j].id < pivot) {
-            i++;
-            swap(students[i], students[j]);
-        }
-    }
-    swap(students[i + 1], students[high]);
-    return (i + 1);
-}
-
-void quickSort(vector<Student>& students, int low, int high) {
-    if (low < high) {
-        int pi = partition(students, low, high);
-        quickSort(students, low, pi - 1);
-        quickSort(students, pi + 1, high);
-    }
-}
-
-// --- HeapSort Implementation (Descending by Score) ---
-
-void heapify(vector<Student>& students, int n, int i) {
-    int smallest = i; // Initialize smallest as root
-    int l = 2 * i + 1; // left = 2*i + 1
-    int r = 2 * i + 2; // right = 2*i + 2
-
-    // If left child is smaller than root
-    if (l < n && students[l].score < students[smallest].score)
-        smallest = l;
-
-    // If right child is smaller than smallest so far
-    if (r < n && students[r].score < students[smallest].score)
-        smallest = r;
-
-    // If smallest is not root
-    if (smallest != i) {
-        swap(students[i], students[smallest]);
-        // Recursively heapify the affected sub-tree
-        heapify(students, n, smallest);
-    }
-}
-
-void heapSort(vector<Student>& students) {
-    int n = students.size();
-
-    // Build heap (rearrange array)
-    for (int i = n / 2 - 1; i >= 0; i--)
-        heapify(students, n, i);
-
-    // One by one extract an element from heap
-    for (int i = n - 1; i > 0; i--) {
-        // Move current root to end
-        swap(students[0], students[i]);
-
-        // call max heapify on the reduced heap
-        heapify(students, i, 0);
-    }
-}
-
 // --- Main Function ---
 
 // Custom function to check if the student list is empty
@@ -96,6 +45,15 @@ void printStudentsCSV(const vector<Student>& students) {
     }
 }
 
+// Print students in the row order given by a permutation
+void printStudentsCSV(const vector<Student>& students, const vector<uint32_t>& order) {
+    cout << "id,name,score" << endl;
+    for (uint32_t row : order) {
+        const Student& s = students[row];
+        cout << s.id << "," << s.name << "," << s.score << endl;
+    }
+}
+
 void inputStudents(vector<Student>& students) {
     int n;
     cout << "Enter number of students to add: ";
@@ -149,6 +107,252 @@ void loadStudentsFromFile(vector<Student>& students, const string& filename) {
     infile.close();
 }
 
+// sort_id / sort_score on the columnar store: sort a row permutation, then print through it
+int runColumnarSort(const string& command, const string& filename, unsigned threads) {
+    StudentTable table;
+    if (!filename.empty()) {
+        loadStudentTableMapped(table, filename, threads);
+    } else {
+        vector<Student> defaults;
+        initStudents(defaults);
+        table = StudentTable::fromStudents(defaults);
+    }
+
+    vector<uint32_t> order = table.identityOrder();
+    if (command == "sort_id") {
+        parallelSort(order, threads, StudentTable::IdOrder{&table});
+    } else if (command == "sort_score") {
+        parallelSort(order, threads, StudentTable::ScoreDescOrder{&table});
+    } else {
+        cerr << "Unknown command for --columnar: " << command << endl;
+        return 1;
+    }
+    table.printCSV(cout, order);
+    return 0;
+}
+
+// sort_id / sort_score for files larger than memory
+int runExternalSort(const string& command, const string& filename, size_t memoryMB) {
+    ExternalSorter sorter(memoryMB << 20);
+    bool ok;
+    if (command == "sort_id") {
+        ok = sorter.sortFile(filename, cout, IdLess());
+    } else if (command == "sort_score") {
+        ok = sorter.sortFile(filename, cout, ScoreDescLess());
+    } else {
+        cerr << "Unknown command for --memory-mb: " << command << endl;
+        return 1;
+    }
+    return ok ? 0 : 1;
+}
+
+// top_k K: the K best scores in one streaming pass
+int runTopK(size_t k, const string& filename) {
+    TopKCollector collector(k);
+    if (!filename.empty()) {
+        bool ok = streamStudentFile(filename, [&collector](string_view id, string_view name, float score) {
+            collector.offer(id, name, score);
+        });
+        if (!ok) return 1;
+    } else {
+        vector<Student> defaults;
+        initStudents(defaults);
+        for (const auto& s : defaults) collector.offer(s.id, s.name, s.score);
+    }
+    printStudentsCSV(collector.result());
+    return 0;
+}
+
+// rank <id>: position of one student in the score ranking, from two
+// streaming passes over the file (nothing is kept per row)
+int runRank(const string& id, const string& filename) {
+    vector<Student> defaults;
+    if (filename.empty()) initStudents(defaults);
+    auto scan = [&](auto onRow, bool reportMalformed) {
+        if (!filename.empty()) return streamStudentFile(filename, onRow, reportMalformed);
+        for (const auto& s : defaults) onRow(s.id, s.name, s.score);
+        return true;
+    };
+
+    Student student;
+    size_t rank, total;
+    bool found;
+    if (!rankByScore(scan, id, student, rank, total, found)) return 1;
+    if (!found) {
+        cerr << "Student not found: " << id << endl;
+        return 1;
+    }
+    cout << "id,name,score,rank,total" << endl;
+    cout << student.id << "," << student.name << "," << student.score << "," << rank << "," << total << endl;
+    return 0;
+}
+
+// compact: write the binary columnar snapshot of a text file
+int runCompact(const string& input, const string& output, bool withOrders, unsigned threads) {
+    StudentTable table;
+    if (!loadStudentTableMapped(table, input, threads)) return 1;
+    if (!writeStudentSnapshot(table, output, withOrders)) return 1;
+    cout << "Wrote " << table.size() << " students to " << output << endl;
+    return 0;
+}
+
+// sort_id / sort_score on a snapshot: dump the stored permutation if present
+int runSnapshotSort(const string& command, const string& filename, unsigned threads) {
+    StudentSnapshot snapshot;
+    if (!snapshot.open(filename)) return 1;
+
+    const uint32_t* stored = command == "sort_id" ? snapshot.idOrder() : snapshot.scoreOrder();
+    if (stored != nullptr) {
+        snapshot.printCSV(cout, stored);
+        return 0;
+    }
+
+    StudentTable table = snapshot.toTable();
+    vector<uint32_t> order = table.identityOrder();
+    if (command == "sort_id") {
+        parallelSort(order, threads, StudentTable::IdOrder{&table});
+    } else {
+        parallelSort(order, threads, StudentTable::ScoreDescOrder{&table});
+    }
+    table.printCSV(cout, order);
+    return 0;
+}
+
+// stats: mean, standard deviation, min/max, percentiles and histogram
+int runStats(const string& filename, bool json, unsigned threads) {
+    GradeStats st;
+    if (!filename.empty() && StudentSnapshot::isSnapshot(filename)) {
+        StudentSnapshot snapshot;
+        if (!snapshot.open(filename)) return 1;
+        st = computeGradeStats(snapshot.scoreData(), snapshot.size());
+    } else {
+        StudentTable table;
+        if (!filename.empty()) {
+            if (!loadStudentTableMapped(table, filename, threads)) return 1;
+        } else {
+            vector<Student> defaults;
+            initStudents(defaults);
+            table = StudentTable::fromStudents(defaults);
+        }
+        st = computeGradeStats(table.scoreData(), table.size());
+    }
+
+    if (json) {
+        printGradeStatsJSON(cout, st);
+    } else {
+        printGradeStatsCSV(cout, st);
+    }
+    return 0;
+}
+
+// The saved index for filename, or a fresh one built with a full sort
+void loadOrBuildIndex(StudentIndex& index, const string& filename) {
+    if (index.load(filename)) return;
+    vector<Student> rows;
+    loadStudentsFromFile(rows, filename);
+    index.build(rows);
+}
+
+// Append one "ID Name Score" line, starting a new line if the file lacks a trailing newline
+bool appendStudentLine(const string& filename, const string& line) {
+    bool needNewline = false;
+    {
+        ifstream in(filename, ios::binary);
+        if (in && in.seekg(0, ios::end) && in.tellg() > 0) {
+            in.seekg(-1, ios::end);
+            needNewline = in.get() != '\n';
+        }
+    }
+    ofstream out(filename, ios::binary | ios::app);
+    if (!out) return false;
+    if (needNewline) out << '\n';
+    out << line << '\n';
+    return static_cast<bool>(out);
+}
+
+// Rewrite filename without the rows whose ID equals id
+bool removeStudentLines(const string& filename, const string& id) {
+    string tmp = filename + ".tmp";
+    {
+        ofstream out(tmp, ios::binary);
+        if (!out) return false;
+        bool ok = streamStudentLines(filename, [&](const string& line, string_view rowId) {
+            if (rowId != id) out << line << '\n';
+        });
+        if (!ok || !out) return false;
+    }
+    error_code ec;
+    filesystem::rename(tmp, filename, ec);
+    return !ec;
+}
+
+// add / delete keep the data file and its sorted indexes in step;
+// build_index rebuilds them, check_index compares them with a full re-sort
+int runIndexCommand(const string& command, const vector<string>& args, const string& filename) {
+    StudentIndex index;
+
+    if (command == "build_index") {
+        vector<Student> rows;
+        loadStudentsFromFile(rows, filename);
+        index.build(rows);
+    } else if (command == "add") {
+        string line = args[0] + " " + args[1] + " " + args[2];
+        string_view id, name;
+        float score;
+        if (parseStudentLine(line, id, name, score) != LINE_OK || id != args[0] || name != args[1]) {
+            cerr << "Invalid student: " << line << endl;
+            return 1;
+        }
+        loadOrBuildIndex(index, filename);
+        if (!appendStudentLine(filename, line)) {
+            cerr << "Error opening file for writing: " << filename << endl;
+            return 1;
+        }
+        index.insert({args[0], args[1], score});
+    } else if (command == "delete") {
+        loadOrBuildIndex(index, filename);
+        size_t removed = index.removeId(args[0]);
+        if (removed > 0 && !removeStudentLines(filename, args[0])) {
+            cerr << "Error rewriting file: " << filename << endl;
+            return 1;
+        }
+        cout << "Removed " << removed << " student(s) with ID " << args[0] << endl;
+    } else { // check_index
+        if (!index.load(filename)) {
+            cerr << "Index missing or stale: " << StudentIndex::pathFor(filename) << endl;
+            return 1;
+        }
+        vector<Student> byId, byScore;
+        loadStudentsFromFile(byId, filename);
+        byScore = byId;
+        if (!byId.empty()) quickSort(byId, 0, byId.size() - 1);
+        heapSort(byScore);
+
+        size_t i = 0, mismatches = 0;
+        auto same = [](const Student& a, const Student& b) {
+            return a.id == b.id && a.name == b.name && a.score == b.score;
+        };
+        index.forEachById([&](const Student& s) { mismatches += i >= byId.size() || !same(s, byId[i]); ++i; });
+        mismatches += i != byId.size();
+        i = 0;
+        index.forEachByScore([&](const Student& s) { mismatches += i >= byScore.size() || !same(s, byScore[i]); ++i; });
+        mismatches += i != byScore.size();
+
+        if (mismatches > 0) {
+            cerr << "Index mismatch: " << mismatches << " difference(s)" << endl;
+            return 1;
+        }
+        cout << "Index OK: " << index.size() << " rows" << endl;
+        return 0;
+    }
+
+    if (!index.save(filename)) {
+        cerr << "Error writing index: " << StudentIndex::pathFor(filename) << endl;
+        return 1;
+    }
+    return 0;
+}
+
 int main(int argc, char* argv[]) {
     vector<Student> students;
 
@@ -156,8 +360,95 @@ int main(int argc, char* argv[]) {
     if (argc > 1) {
         string command = argv[1];
         string filename;
-        if (argc > 2) {
-            filename = argv[2];
+        unsigned threads = 1;
+        bool columnar = false;
+        bool withOrders = true; // compact: store sort permutations
+        bool json = false;      // stats: JSON instead of CSV
+        size_t memoryMB = 0; // non-zero: out-of-core sort within this budget
+        vector<string> positional;
+        // Usage: <command> [args...] [file] [--threads N] [--columnar] [--memory-mb N]
+        for (int i = 2; i < argc; ++i) {
+            string arg = argv[i];
+            if (arg == "--threads" && i + 1 < argc) {
+                int t = atoi(argv[++i]);
+                threads = t > 0 ? static_cast<unsigned>(t) : 1;
+            } else if (arg == "--columnar") {
+                columnar = true;
+            } else if (arg == "--no-orders") {
+                withOrders = false;
+            } else if (arg == "--json") {
+                json = true;
+            } else if (arg == "--memory-mb" && i + 1 < argc) {
+                int mb = atoi(argv[++i]);
+                memoryMB = mb > 0 ? static_cast<size_t>(mb) : 1;
+            } else {
+                positional.push_back(arg);
+            }
+        }
+        // Some commands take arguments before the file name
+        size_t fileArg = 0;
+        if (command == "top_k" || command == "rank" || command == "delete") fileArg = 1;
+        if (command == "add") fileArg = 3;
+        if (positional.size() > fileArg) {
+            filename = positional[fileArg];
+        }
+
+        if (command == "top_k" || command == "rank") {
+            if (positional.empty()) {
+                cerr << "Usage: " << command << (command == "top_k" ? " K" : " <id>") << " [file]" << endl;
+                return 1;
+            }
+            if (command == "top_k") {
+                return runTopK(strtoull(positional[0].c_str(), nullptr, 10), filename);
+            }
+            return runRank(positional[0], filename);
+        }
+        if (command == "compact") {
+            if (filename.empty()) {
+                cerr << "Usage: compact <students.txt> [snapshot] [--no-orders]" << endl;
+                return 1;
+            }
+            string snapshot = positional.size() > 1 ? positional[1] : filename + ".snap";
+            return runCompact(filename, snapshot, withOrders, threads);
+        }
+        if (command == "stats") {
+            return runStats(filename, json, threads);
+        }
+        if (command == "add" || command == "delete" || command == "build_index" || command == "check_index") {
+            if (filename.empty()) {
+                cerr << "Usage: add <id> <name> <score> <file> | delete <id> <file> | "
+                     << "build_index <file> | check_index <file>" << endl;
+                return 1;
+            }
+            return runIndexCommand(command, positional, filename);
+        }
+        if ((command == "sort_id" || command == "sort_score") && !filename.empty() &&
+            StudentSnapshot::isSnapshot(filename)) {
+            return runSnapshotSort(command, filename, threads);
+        }
+        if ((command == "sort_id" || command == "sort_score") && !filename.empty() &&
+            threads == 1 && !columnar && memoryMB == 0) {
+            // Serve from an up-to-date index without sorting
+            StudentIndex index;
+            if (index.load(filename)) {
+                cout << "id,name,score\n";
+                auto print = [](const Student& s) { cout << s.id << ',' << s.name << ',' << s.score << '\n'; };
+                if (command == "sort_id") {
+                    index.forEachById(print);
+                } else {
+                    index.forEachByScore(print);
+                }
+                cout.flush();
+                return 0;
+            }
+        }
+        if (memoryMB > 0 && !filename.empty()) {
+            return runExternalSort(command, filename, memoryMB);
+        }
+        if (columnar) {
+            return runColumnarSort(command, filename, threads);
+        }
+        if (!filename.empty()) {
             loadStudentsFromFile(students, filename);
         } else {
              // Fallback to default if no file provided (for backward compatibility/testing)
@@ -165,15 +456,31 @@ int main(int argc, char* argv[]) {
         }
 
         if (command == "sort_id") {
-            if (!students.empty()) {
+            if (threads > 1) {
+                parallelSort(students, threads, IdLess());
+            } else if (!students.empty()) {
                 quickSort(students, 0, students.size() - 1);
             }
             printStudentsCSV(students);
         } else if (command == "sort_score") {
-            if (!students.empty()) {
+            if (threads > 1) {
+                parallelSort(students, threads, ScoreDescLess());
+            } else if (!students.empty()) {
                 heapSort(students);
             }
             printStudentsCSV(students);
+        } else if (command == "sort_id_radix") {
+            printStudentsCSV(students, radixOrderById(students));
+        } else if (command == "sort_score_radix") {
+            printStudentsCSV(students, radixOrderByScoreDesc(students));
+        } else if (command == "sort_score_asc") {
+            printStudentsCSV(students, ScoreAscKeys::order(students));
+        } else if (command == "sort_name") {
+            printStudentsCSV(students, NameKeys::order(students));
+        } else if (command == "sort_id_num") {
+            printStudentsCSV(students, IdNumberKeys::order(students));
+        } else if (command == "sort_id_keys") {
+            printStudentsCSV(students, IdKeys::order(students));
         } else {
             cerr << "Unknown command: " << command << endl;
             return 1;
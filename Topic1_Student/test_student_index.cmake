@@ -0,0 +1,51 @@
+# 索引增删测试：在临时副本上建索引，逐条 add / delete 后用 check_index
+# 与整体重排结果比对；成绩为 nan / inf 的 add 必须失败且不改动数据
+#
+# 用法: cmake -DSTUDENT_BIN=<Topic1_Student> -DDATA=<students.txt> -DWORK_DIR=<dir> -P test_student_index.cmake
+
+file(REMOVE_RECURSE "${WORK_DIR}")
+file(MAKE_DIRECTORY "${WORK_DIR}")
+set(file "${WORK_DIR}/students.txt")
+configure_file("${DATA}" "${file}" COPYONLY)
+
+function(run)
+    execute_process(COMMAND "${STUDENT_BIN}" ${ARGN} RESULT_VARIABLE result OUTPUT_VARIABLE output ERROR_VARIABLE output)
+    if(NOT result EQUAL 0)
+        string(REPLACE ";" " " command "${ARGN}")
+        message(FATAL_ERROR "${command} 失败 (${result}):\n${output}")
+    endif()
+endfunction()
+
+# 应当失败的命令（不得改动数据文件与索引）
+function(run_fails)
+    execute_process(COMMAND "${STUDENT_BIN}" ${ARGN} RESULT_VARIABLE result OUTPUT_QUIET ERROR_QUIET)
+    if(result EQUAL 0)
+        string(REPLACE ";" " " command "${ARGN}")
+        message(FATAL_ERROR "${command} 应当失败")
+    endif()
+endfunction()
+
+run(build_index "${file}")
+run(check_index "${file}")
+foreach(i RANGE 1 20)
+    run(add "T${i}" "Test${i}" "${i}.5" "${file}")
+    run(check_index "${file}")
+endforeach()
+foreach(i RANGE 1 20 2)
+    run(delete "T${i}" "${file}")
+    run(check_index "${file}")
+endforeach()
+# 非有限成绩（nan / inf）不得写入
+foreach(score nan NaN inf -inf Infinity)
+    run_fails(add "Bad${score}" "Bad" "${score}" "${file}")
+    run(check_index "${file}")
+endforeach()
+file(STRINGS "${file}" rows REGEX "^Bad")
+if(rows)
+    message(FATAL_ERROR "非有限成绩被写入数据文件: ${rows}")
+endif()
+# 删除原有数据中的一行（同时重写数据文件）
+file(STRINGS "${DATA}" lines LIMIT_COUNT 1)
+string(REGEX MATCH "^[^ \t]+" firstId "${lines}")
+run(delete "${firstId}" "${file}")
+run(check_index "${file}")
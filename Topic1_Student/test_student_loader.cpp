@@ -0,0 +1,85 @@
+// Loader test: which "ID Name Score" lines parseStudentLine accepts, and that
+// the mapped and streaming loaders keep exactly the accepted rows.
+//
+// Usage: test_student_loader
+//
+// Scores must read like operator>> reads them: an optional '+' and exponent
+// are fine, but "nan", "inf" and "infinity" (which std::from_chars accepts)
+// are malformed lines. Exits non-zero on the first failure.
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdio>
+#include "StudentLoader.h"
+
+using namespace std;
+
+bool fail(const string& what) {
+    fprintf(stderr, "test_student_loader: %s\n", what.c_str());
+    return false;
+}
+
+bool checkLines() {
+    struct Case {
+        const char* line;
+        LineStatus status;
+        float score;
+    };
+    const Case cases[] = {
+        {"1001 Alice 85.5", LINE_OK, 85.5f},
+        {"  1002\tBob  +92  ", LINE_OK, 92.0f},
+        {"1003 Carol 7e1\r", LINE_OK, 70.0f},
+        {"1004 Dave -5", LINE_OK, -5.0f},
+        {"", LINE_BLANK, 0},
+        {" \t\r", LINE_BLANK, 0},
+        {"1005 Eve", LINE_MALFORMED, 0},
+        {"1006 Frank 8x", LINE_MALFORMED, 0},
+        {"1007 Grace nan", LINE_MALFORMED, 0},
+        {"1008 Heidi NaN", LINE_MALFORMED, 0},
+        {"1009 Ivan inf", LINE_MALFORMED, 0},
+        {"1010 Judy -inf", LINE_MALFORMED, 0},
+        {"1011 Ken +Infinity", LINE_MALFORMED, 0},
+        {"1012 Leo 1e999", LINE_MALFORMED, 0},
+    };
+    for (const Case& c : cases) {
+        string_view id, name;
+        float score = 0.0f;
+        LineStatus status = parseStudentLine(c.line, id, name, score);
+        if (status != c.status) return fail(string("wrong status for \"") + c.line + "\"");
+        if (status == LINE_OK && score != c.score) return fail(string("wrong score for \"") + c.line + "\"");
+    }
+    return true;
+}
+
+bool checkFile() {
+    string path = "test_student_loader.txt";
+    {
+        ofstream out(path);
+        out << "1 A nan\n2 B 50\n3 C inf\n4 D -Infinity\n5 E 70\n";
+    }
+    // The rejected lines are reported on stderr; keep the test output quiet
+    streambuf* saved = cerr.rdbuf(nullptr);
+    StudentTable table;
+    bool mapped = loadStudentTableMapped(table, path);
+    vector<string> streamed;
+    bool ok = streamStudentFile(path, [&](string_view id, string_view, float) { streamed.emplace_back(id); });
+    cerr.rdbuf(saved);
+    remove(path.c_str());
+
+    if (!mapped || !ok) return fail("could not read the test file");
+    if (table.size() != 2 || table.id(0) != "2" || table.score(0) != 50.0f || table.id(1) != "5" ||
+        table.score(1) != 70.0f) {
+        return fail("mapped load kept a non-finite score");
+    }
+    if (streamed != vector<string>{"2", "5"}) return fail("streaming load kept a non-finite score");
+    return true;
+}
+
+int main() {
+    if (!checkLines() || !checkFile()) return 1;
+    printf("Loader OK\n");
+    return 0;
+}
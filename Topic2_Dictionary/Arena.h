@@ -0,0 +1,114 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <vector>
+#include <string_view>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+
+// --- Arena storage for the dictionary tree ---
+//
+// Nodes live in one contiguous vector and refer to each other by 32-bit
+// index; words and meanings live in one shared byte arena and are referred to
+// by (offset, length). A million-entry tree is then two allocations instead
+// of one node allocation plus up to two string allocations per entry, and
+// dropping the whole tree is O(1).
+
+// Index of a node in a NodePool; NIL is the null link
+typedef uint32_t NodeId;
+const NodeId NIL = 0xFFFFFFFFu;
+
+// A string stored in a StringArena
+struct StrRef {
+    uint32_t offset;
+    uint32_t length;
+};
+
+// First 8 bytes of s as a big-endian integer, zero-padded: comparing two
+// prefixes orders the strings unless the prefixes are equal
+inline uint64_t keyPrefix(std::string_view s) {
+    uint64_t p = 0;
+    for (std::size_t i = 0; i < 8; i++) {
+        p = (p << 8) | (i < s.size() ? static_cast<unsigned char>(s[i]) : 0);
+    }
+    return p;
+}
+
+// Append-only byte pool. Released strings are only counted as garbage; the
+// owner compacts by re-adding the live strings to a fresh arena.
+class StringArena {
+private:
+    std::vector<char> bytes;
+    std::size_t garbage = 0;
+
+public:
+    StrRef add(std::string_view s) {
+        StrRef ref{static_cast<uint32_t>(bytes.size()), static_cast<uint32_t>(s.size())};
+        bytes.insert(bytes.end(), s.begin(), s.end());
+        return ref;
+    }
+
+    std::string_view get(StrRef ref) const {
+        return std::string_view(bytes.data() + ref.offset, ref.length);
+    }
+
+    void release(StrRef ref) { garbage += ref.length; }
+
+    void reserve(std::size_t n) { bytes.reserve(n); }
+    void clear() {
+        bytes.clear();
+        garbage = 0;
+    }
+    void swap(StringArena& other) {
+        bytes.swap(other.bytes);
+        std::swap(garbage, other.garbage);
+    }
+
+    std::size_t size() const { return bytes.size(); }
+    std::size_t garbageBytes() const { return garbage; }
+    std::size_t capacityBytes() const { return bytes.capacity(); }
+};
+
+// Fixed-size node pool; released slots are reused before the pool grows.
+// The pool does not touch a released node, so owners that need to tell live
+// slots from released ones mark them before calling release().
+template <typename Node>
+class NodePool {
+private:
+    std::vector<Node> nodes;
+    std::vector<NodeId> freeIds;
+
+public:
+    Node& operator[](NodeId id) { return nodes[id]; }
+    const Node& operator[](NodeId id) const { return nodes[id]; }
+
+    // Note: may reallocate, so references to nodes do not survive an alloc()
+    NodeId alloc(const Node& init) {
+        if (!freeIds.empty()) {
+            NodeId id = freeIds.back();
+            freeIds.pop_back();
+            nodes[id] = init;
+            return id;
+        }
+        nodes.push_back(init);
+        return static_cast<NodeId>(nodes.size() - 1);
+    }
+
+    void release(NodeId id) { freeIds.push_back(id); }
+
+    void reserve(std::size_t n) { nodes.reserve(n); }
+    void clear() {
+        nodes.clear();
+        freeIds.clear();
+    }
+
+    std::size_t size() const { return nodes.size() - freeIds.size(); }
+    // Number of slots, live or released (valid ids are below this)
+    std::size_t slots() const { return nodes.size(); }
+    std::size_t capacityBytes() const {
+        return nodes.capacity() * sizeof(Node) + freeIds.capacity() * sizeof(NodeId);
+    }
+};
+
+#endif // ARENA_H
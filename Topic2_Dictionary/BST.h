@@ -3,136 +3,233 @@
 
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <iomanip>
 #include <fstream>
+#include <filesystem>
 #include <algorithm>
+#include <cmath>
+#include <vector>
+#include <utility>
+#include <optional>
+#include <cstdint>
+#include "Arena.h"
+#include "FileSync.h"
 
 using namespace std;
 
-// BST Node Structure
-struct BSTNode {
-    string word;
-    string meaning;
-    BSTNode* left;
-    BSTNode* right;
+// One dictionary entry: (word, meaning)
+typedef pair<string, string> Entry;
+
+// Sort entries by word, keeping only the last entry of each run of equal
+// words (exactly as repeated insert() would). Sorted input, which is what
+// saveToFile writes, is detected and not re-sorted.
+inline void sortUniqueEntries(vector<Entry>& entries) {
+    bool sorted = true;
+    for (size_t i = 1; i < entries.size() && sorted; i++) {
+        sorted = !(entries[i].first < entries[i - 1].first);
+    }
+    if (!sorted) {
+        // Stable: among equal words the later entry stays later
+        stable_sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.first < b.first; });
+    }
+
+    // Last one wins: keep the final entry of each run of equal words
+    size_t unique = 0;
+    for (size_t i = 0; i < entries.size(); i++) {
+        if (i + 1 < entries.size() && entries[i + 1].first == entries[i].first) continue;
+        if (unique != i) entries[unique] = move(entries[i]);
+        unique++;
+    }
+    entries.resize(unique);
+}
+
+// Merge two sorted, unique entry lists; on equal words `entries` overrides
+inline vector<Entry> mergeEntries(vector<Entry> existing, vector<Entry> entries) {
+    vector<Entry> merged;
+    merged.reserve(existing.size() + entries.size());
+    size_t i = 0, j = 0;
+    while (i < existing.size() || j < entries.size()) {
+        if (j == entries.size() || (i < existing.size() && existing[i].first < entries[j].first)) {
+            merged.push_back(move(existing[i++]));
+        } else {
+            if (i < existing.size() && existing[i].first == entries[j].first) i++;
+            merged.push_back(move(entries[j++]));
+        }
+    }
+    return merged;
+}
 
-    BSTNode(string w, string m) : word(w), meaning(m), left(nullptr), right(nullptr) {}
+// BST Node Structure (32 bytes: strings and children are arena references)
+struct BSTNode {
+    StrRef word;
+    StrRef meaning;
+    NodeId left;
+    NodeId right;
+    int32_t height; // height of the subtree rooted here (leaf = 1, released = 0)
+    uint32_t size;  // number of entries in the subtree rooted here
 };
 
-// Binary Search Tree Class
+// Binary Search Tree Class (AVL balanced)
+//
+// Every insert and remove restores the AVL invariant on the way back up: the
+// heights of a node's two subtrees differ by at most one. The tree height
+// therefore stays below 1.44 * log2(n + 2), so lookups are O(log n) and the
+// recursive helpers stay shallow whatever order the words arrive in.
+//
+// Each node also keeps the size of its subtree, which turns the tree into an
+// order-statistic tree: select(k), rank(word) and countRange(lo, hi) are
+// O(log n), and a page of the sorted entries costs O(log n + page size).
+//
+// Nodes are kept in a NodePool and linked by 32-bit index; all word and
+// meaning bytes share one StringArena (see Arena.h).
 class BST {
 private:
-    BSTNode* root;
+    // Upper bound on the AVL height for up to 2^32 nodes (1.44 * 32 < 47)
+    static const int MAX_HEIGHT = 64;
 
-    // Helper: Insert recursively
-    BSTNode* insert(BSTNode* node, string word, string meaning) {
-        if (node == nullptr) {
-            return new BSTNode(word, meaning);
-        }
+    NodePool<BSTNode> nodes;
+    StringArena strings;
+    NodeId root;
 
-        if (word < node->word) {
-            node->left = insert(node->left, word, meaning);
-        } else if (word > node->word) {
-            node->right = insert(node->right, word, meaning);
-        } else {
-            // Word already exists, update meaning
-            node->meaning = meaning;
-            // Removed verbose output for bulk operations
-        }
-        return node;
-    }
+    string_view word(NodeId node) const { return strings.get(nodes[node].word); }
+    string_view meaning(NodeId node) const { return strings.get(nodes[node].meaning); }
 
-    // Helper: Search recursively
-    string search(BSTNode* node, string word) {
-        if (node == nullptr) {
-            return "Word not found in the dictionary.";
-        }
+    NodeId newNode(string_view word, string_view meaning) {
+        StrRef w = strings.add(word);
+        StrRef m = strings.add(meaning);
+        return nodes.alloc(BSTNode{w, m, NIL, NIL, 1, 1});
+    }
 
-        if (word == node->word) {
-            return node->meaning;
-        } else if (word < node->word) {
-            return search(node->left, word);
-        } else {
-            return search(node->right, word);
-        }
+    // Helper: AVL bookkeeping
+    int height(NodeId node) const {
+        return node == NIL ? 0 : nodes[node].height;
     }
 
-    // Helper: Find minimum value node in a subtree (used for deletion)
-    BSTNode* findMin(BSTNode* node) {
-        while (node && node->left != nullptr) {
-            node = node->left;
-        }
-        return node;
+    uint32_t subtreeSize(NodeId node) const {
+        return node == NIL ? 0 : nodes[node].size;
     }
 
-    // Helper: Delete recursively
-    BSTNode* remove(BSTNode* node, string word) {
-        if (node == nullptr) {
-            cout << "Word '" << word << "' not found." << endl;
-            return nullptr;
-        }
+    // Recompute a node's height and subtree size from its children
+    void updateNode(NodeId node) {
+        nodes[node].height = 1 + max(height(nodes[node].left), height(nodes[node].right));
+        nodes[node].size = 1 + subtreeSize(nodes[node].left) + subtreeSize(nodes[node].right);
+    }
 
-        // 1. Locate the node to be deleted
-        if (word < node->word) {
-            node->left = remove(node->left, word);
-        } else if (word > node->word) {
-            node->right = remove(node->right, word);
-        } else {
-            // Found the node to delete
+    int balanceFactor(NodeId node) const {
+        return height(nodes[node].left) - height(nodes[node].right);
+    }
 
-            // Case 1: Node has no children (Leaf node)
-            if (node->left == nullptr && node->right == nullptr) {
-                delete node;
-                node = nullptr;
-            }
-            // Case 2: Node has only one child
-            else if (node->left == nullptr) {
-                BSTNode* temp = node;
-                node = node->right; // Replace with right child
-                delete temp;
-            } else if (node->right == nullptr) {
-                BSTNode* temp = node;
-                node = node->left; // Replace with left child
-                delete temp;
-            }
-            // Case 3: Node has two children
-            else {
-                // Strategy: Find the Inorder Successor (smallest node in the right subtree)
-                BSTNode* temp = findMin(node->right);
+    NodeId rotateRight(NodeId node) {
+        NodeId pivot = nodes[node].left;
+        nodes[node].left = nodes[pivot].right;
+        nodes[pivot].right = node;
+        updateNode(node);
+        updateNode(pivot);
+        return pivot;
+    }
 
-                // Copy the successor's content to this node
-                node->word = temp->word;
-                node->meaning = temp->meaning;
+    NodeId rotateLeft(NodeId node) {
+        NodeId pivot = nodes[node].right;
+        nodes[node].right = nodes[pivot].left;
+        nodes[pivot].left = node;
+        updateNode(node);
+        updateNode(pivot);
+        return pivot;
+    }
 
-                // Delete the successor node from the right subtree
-                node->right = remove(node->right, temp->word);
-            }
+    // Restore the AVL invariant at node after one of its subtrees changed height by one
+    NodeId rebalance(NodeId node) {
+        updateNode(node);
+        int balance = balanceFactor(node);
+        if (balance > 1) {
+            // Left-Right case: straighten the left subtree first
+            if (balanceFactor(nodes[node].left) < 0) nodes[node].left = rotateLeft(nodes[node].left);
+            return rotateRight(node);
+        }
+        if (balance < -1) {
+            // Right-Left case
+            if (balanceFactor(nodes[node].right) > 0) nodes[node].right = rotateRight(nodes[node].right);
+            return rotateLeft(node);
         }
         return node;
     }
 
+    // Helper: Point parent's left or right link (or the root, if parent is NIL) at child
+    void link(NodeId parent, bool leftSide, NodeId child) {
+        if (parent == NIL) {
+            root = child;
+        } else if (leftSide) {
+            nodes[parent].left = child;
+        } else {
+            nodes[parent].right = child;
+        }
+    }
+
+    // Helper: Rewrite the string arena once more than half of it is garbage
+    void compactStrings() {
+        if (strings.garbageBytes() < 4096 || strings.garbageBytes() * 2 < strings.size()) return;
+        StringArena fresh;
+        fresh.reserve(strings.size() - strings.garbageBytes());
+        for (NodeId id = 0; id < nodes.slots(); id++) {
+            BSTNode& n = nodes[id];
+            if (n.height == 0) continue; // released slot
+            n.word = fresh.add(strings.get(n.word));
+            n.meaning = fresh.add(strings.get(n.meaning));
+        }
+        strings.swap(fresh);
+    }
+
     // Helper: In-order traversal
-    void inOrder(BSTNode* node) {
-        if (node == nullptr) return;
+    void inOrder(NodeId node) const {
+        if (node == NIL) return;
+
+        inOrder(nodes[node].left);
+        cout << left << setw(20) << word(node) << ": " << meaning(node) << endl;
+        inOrder(nodes[node].right);
+    }
 
-        inOrder(node->left);
-        cout << left << setw(20) << node->word << ": " << node->meaning << endl;
-        inOrder(node->right);
+    // Helper: Collect entries in order (used when bulk-loading into a non-empty tree)
+    void collect(NodeId node, vector<Entry>& out) const {
+        if (node == NIL) return;
+        collect(nodes[node].left, out);
+        out.emplace_back(string(word(node)), string(meaning(node)));
+        collect(nodes[node].right, out);
     }
 
-    // Helper: Clear tree (destructor)
-    void clear(BSTNode* node) {
-        if (node == nullptr) return;
-        clear(node->left);
-        clear(node->right);
-        delete node;
+    // Helper: Build a perfectly balanced subtree from sorted, unique entries [lo, hi)
+    NodeId buildBalanced(const vector<Entry>& entries, size_t lo, size_t hi) {
+        if (lo >= hi) return NIL;
+        size_t mid = lo + (hi - lo) / 2;
+        NodeId node = newNode(entries[mid].first, entries[mid].second);
+        NodeId l = buildBalanced(entries, lo, mid);
+        NodeId r = buildBalanced(entries, mid + 1, hi);
+        nodes[node].left = l;
+        nodes[node].right = r;
+        updateNode(node);
+        return node;
+    }
+
+    // Helper: Validate ordering, stored heights and sizes, and the AVL invariant.
+    // Returns the subtree height, or -1 if the subtree is invalid.
+    int checkBalance(NodeId node, const string_view* lo, const string_view* hi, size_t& count) const {
+        if (node == NIL) return 0;
+        string_view w = word(node);
+        if ((lo && !(*lo < w)) || (hi && !(w < *hi))) return -1;
+        size_t before = count++;
+        int lh = checkBalance(nodes[node].left, lo, &w, count);
+        int rh = checkBalance(nodes[node].right, &w, hi, count);
+        if (lh < 0 || rh < 0 || abs(lh - rh) > 1) return -1;
+        if (count - before != nodes[node].size) return -1;
+        int h = 1 + max(lh, rh);
+        return h == nodes[node].height ? h : -1;
     }
 
     // Helper: Print tree structure with indentation
     // indent: Current indentation string
     // last: Is this node the last child of its parent?
-    void printTree(BSTNode* node, string indent, bool last) {
-        if (node != nullptr) {
+    void printTree(NodeId node, string indent, bool last) const {
+        if (node != NIL) {
             cout << indent;
             if (last) {
                 cout << "R----";
@@ -141,55 +238,36 @@ private:
                 cout << "L----";
                 indent += "|  ";
             }
-            cout << node->word << endl;
-            printTree(node->left, indent, false);
-            printTree(node->right, indent, true);
-        }
-    }
-
-    // Helper: Recursive fuzzy search
-    void searchByPrefix(BSTNode* node, string prefix) {
-        if (node == nullptr) return;
-
-        // Optimized traversal:
-        // If node's word is smaller than prefix, we only need to look at right subtree
-        // But prefix matching is tricky because "apple" > "app".
-        // Let's stick to standard In-Order traversal and check condition for simplicity and correctness
-
-        searchByPrefix(node->left, prefix);
-
-        // Check if node->word starts with prefix
-        if (node->word.find(prefix) == 0) {
-            cout << left << setw(20) << node->word << ": " << node->meaning << endl;
+            cout << word(node) << endl;
+            printTree(nodes[node].left, indent, false);
+            printTree(nodes[node].right, indent, true);
         }
-
-        searchByPrefix(node->right, prefix);
     }
 
     // Helper: Save to file (In-order traversal)
-    void saveToFile(BSTNode* node, ofstream& outFile) {
-        if (node == nullptr) return;
-        saveToFile(node->left, outFile);
-        outFile << node->word << ":" << node->meaning << endl;
-        saveToFile(node->right, outFile);
+    void saveToFile(NodeId node, ofstream& outFile) const {
+        if (node == NIL) return;
+        saveToFile(nodes[node].left, outFile);
+        outFile << word(node) << ":" << meaning(node) << endl;
+        saveToFile(nodes[node].right, outFile);
     }
 
     // Helper: Serialize to JSON
     // Format: { "name": "word", "children": [ ... ] }
-    void serializeJSON(BSTNode* node, bool isLast) {
-        if (node == nullptr) return;
+    void serializeJSON(NodeId node, bool isLast) const {
+        if (node == NIL) return;
 
         cout << "{";
-        cout << "\"name\": \"" << node->word << "\"";
+        cout << "\"name\": \"" << word(node) << "\"";
 
-        if (node->left != nullptr || node->right != nullptr) {
+        if (nodes[node].left != NIL || nodes[node].right != NIL) {
             cout << ", \"children\": [";
-            if (node->left) {
-                serializeJSON(node->left, node->right == nullptr);
+            if (nodes[node].left != NIL) {
+                serializeJSON(nodes[node].left, nodes[node].right == NIL);
             }
-            if (node->right) {
-                if (node->left) cout << ", ";
-                serializeJSON(node->right, true);
+            if (nodes[node].right != NIL) {
+                if (nodes[node].left != NIL) cout << ", ";
+                serializeJSON(nodes[node].right, true);
             }
             cout << "]";
         }
@@ -202,47 +280,186 @@ private:
     }
 
     // Helper 2: Serialize to JSON with proper stream handling
-    void printJSON(BSTNode* node) {
-         if (node == nullptr) return;
+    // side: "L" / "R" for a left / right child, empty for the root
+    void printJSON(NodeId node, string side = "") const {
+         if (node == NIL) return;
 
-         cout << "{\"name\": \"" << node->word << "\"";
-         if (node->left || node->right) {
+         cout << "{\"name\": \"" << word(node) << "\"";
+         if (!side.empty()) {
+             cout << ", \"side\": \"" << side << "\"";
+         }
+         NodeId l = nodes[node].left, r = nodes[node].right;
+         if (l != NIL || r != NIL) {
              cout << ", \"children\": [";
-             if (node->left) {
-                 printJSON(node->left);
+             if (l != NIL) {
+                 printJSON(l, "L");
              }
-             if (node->left && node->right) {
+             if (l != NIL && r != NIL) {
                  cout << ", ";
              }
-             if (node->right) {
-                 printJSON(node->right);
+             if (r != NIL) {
+                 printJSON(r, "R");
              }
              cout << "]";
          }
          cout << "}";
     }
 
+    // Helper: Continue an in-order walk from a stack of pending nodes
+    template <typename Fn>
+    void scanStack(NodeId* stack, int top, Fn& fn) const {
+        while (top > 0) {
+            NodeId node = stack[--top];
+            if (!fn(node)) return;
+            for (NodeId next = nodes[node].right; next != NIL; next = nodes[next].left) {
+                stack[top++] = next;
+            }
+        }
+    }
+
 public:
-    BST() : root(nullptr) {}
+    BST() : root(NIL) {}
+
+    // Drop every entry: O(1), the pool and arena are released wholesale
+    void clear() {
+        nodes.clear();
+        strings.clear();
+        root = NIL;
+    }
+
+    size_t size() const { return nodes.size(); }
+
+    // Heap bytes held by the node pool and string arena
+    size_t memoryBytes() const {
+        return sizeof(*this) + nodes.capacityBytes() + strings.capacityBytes();
+    }
 
-    ~BST() {
-        clear(root);
+    // Iterative lookup: no recursion and no allocation on a hit or a miss.
+    // The view is valid until the next insert, remove or load.
+    optional<string_view> find(string_view word) const {
+        NodeId node = root;
+        while (node != NIL) {
+            int cmp = word.compare(this->word(node));
+            if (cmp == 0) return meaning(node);
+            node = cmp < 0 ? nodes[node].left : nodes[node].right;
+        }
+        return nullopt;
     }
 
-    void insert(string word, string meaning) {
-        root = insert(root, word, meaning);
+    // Entry access by node id, for indexes that refer into the tree
+    string_view wordAt(NodeId node) const { return word(node); }
+    string_view meaningAt(NodeId node) const { return meaning(node); }
+
+    string search(string_view word) const {
+        optional<string_view> found = find(word);
+        return found ? string(*found) : "Word not found in the dictionary.";
     }
 
-    string search(string word) {
-        return search(root, word);
+    // Iterative insert: descend once recording the path, then rebalance
+    // bottom-up until a subtree keeps its old height.
+    // (word and meaning must not point into this tree's own storage)
+    // Returns the node holding word (its id is stable until the word is removed
+    // or the tree is reloaded).
+    NodeId insert(string_view word, string_view meaning) {
+        NodeId path[MAX_HEIGHT];
+        bool wentLeft[MAX_HEIGHT];
+        int depth = 0;
+        for (NodeId node = root; node != NIL; depth++) {
+            int cmp = word.compare(this->word(node));
+            if (cmp == 0) {
+                // Word already exists, update meaning
+                strings.release(nodes[node].meaning);
+                nodes[node].meaning = strings.add(meaning);
+                compactStrings();
+                return node;
+            }
+            path[depth] = node;
+            wentLeft[depth] = cmp < 0;
+            node = cmp < 0 ? nodes[node].left : nodes[node].right;
+        }
+
+        NodeId added = newNode(word, meaning);
+        NodeId child = added;
+        while (depth > 0) {
+            depth--;
+            NodeId parent = path[depth];
+            link(parent, wentLeft[depth], child);
+            int before = nodes[parent].height;
+            child = rebalance(parent);
+            if (nodes[child].height == before) break; // ancestors' heights are unchanged
+        }
+        link(depth > 0 ? path[depth - 1] : NIL, depth > 0 && wentLeft[depth - 1], child);
+        // ...but every ancestor's subtree gained one entry
+        for (int i = 0; i < depth; i++) nodes[path[i]].size++;
+        return added;
     }
 
-    void remove(string word) {
-        root = remove(root, word);
+    // Iterative remove. A node with two children is replaced by relinking its
+    // in-order successor node into its place, so every other entry keeps its
+    // node id.
+    void remove(string_view word) {
+        NodeId path[MAX_HEIGHT];
+        bool wentLeft[MAX_HEIGHT];
+        int depth = 0;
+        NodeId target = root;
+        while (target != NIL) {
+            int cmp = word.compare(this->word(target));
+            if (cmp == 0) break;
+            path[depth] = target;
+            wentLeft[depth] = cmp < 0;
+            depth++;
+            target = cmp < 0 ? nodes[target].left : nodes[target].right;
+        }
+        if (target == NIL) {
+            cout << "Word '" << word << "' not found." << endl;
+            return;
+        }
+
+        int targetDepth = depth;
+        if (nodes[target].left == NIL || nodes[target].right == NIL) {
+            // Case 1 / 2: Node has at most one child, which replaces it
+            NodeId child = nodes[target].left != NIL ? nodes[target].left : nodes[target].right;
+            link(depth > 0 ? path[depth - 1] : NIL, depth > 0 && wentLeft[depth - 1], child);
+        } else {
+            // Case 3: Node has two children
+            // Strategy: unlink the Inorder Successor (smallest node in the right
+            // subtree) and put it where the target was
+            path[depth] = target;
+            wentLeft[depth] = false;
+            depth++;
+            NodeId successor = nodes[target].right;
+            while (nodes[successor].left != NIL) {
+                path[depth] = successor;
+                wentLeft[depth] = true;
+                depth++;
+                successor = nodes[successor].left;
+            }
+            link(path[depth - 1], wentLeft[depth - 1], nodes[successor].right);
+
+            nodes[successor].left = nodes[target].left;
+            nodes[successor].right = nodes[target].right;
+            nodes[successor].height = nodes[target].height;
+            nodes[successor].size = nodes[target].size;
+            path[targetDepth] = successor;
+            link(targetDepth > 0 ? path[targetDepth - 1] : NIL, targetDepth > 0 && wentLeft[targetDepth - 1],
+                 successor);
+        }
+        strings.release(nodes[target].word);
+        strings.release(nodes[target].meaning);
+        nodes[target].height = 0; // mark the slot released for compactStrings
+        nodes.release(target);
+
+        // Rebalance every ancestor of the removed position, bottom-up
+        while (depth > 0) {
+            depth--;
+            NodeId sub = rebalance(path[depth]);
+            link(depth > 0 ? path[depth - 1] : NIL, depth > 0 && wentLeft[depth - 1], sub);
+        }
+        compactStrings();
     }
 
-    void inOrder() {
-        if (root == nullptr) {
+    void inOrder() const {
+        if (root == NIL) {
             cout << "Dictionary is empty." << endl;
         } else {
             cout << "----------------------------------------" << endl;
@@ -253,9 +470,34 @@ public:
         }
     }
 
+    // Extension: Balance check (used by the check_tree CLI command)
+    // Verifies the search-tree order, every stored height, the AVL balance
+    // condition and the height bound 1.44 * log2(n + 2).
+    bool checkBalance() const {
+        size_t count = 0;
+        int h = checkBalance(root, nullptr, nullptr, count);
+        if (h < 0) {
+            cout << "Tree check FAILED: order, size or AVL invariant violated" << endl;
+            return false;
+        }
+        double bound = 1.4405 * log2(static_cast<double>(count) + 2) - 0.3277;
+        cout << "Entries: " << count << ", height: " << h << ", AVL bound: " << fixed << setprecision(2)
+             << bound << endl;
+        if (h > bound) {
+            cout << "Tree check FAILED: height exceeds the AVL bound" << endl;
+            return false;
+        }
+        if (count != nodes.size()) {
+            cout << "Tree check FAILED: " << nodes.size() << " live nodes in the pool" << endl;
+            return false;
+        }
+        cout << "Tree check OK" << endl;
+        return true;
+    }
+
     // Extension: Visualization
-    void printTree() {
-        if (root == nullptr) {
+    void printTree() const {
+        if (root == NIL) {
             cout << "Tree is empty." << endl;
             return;
         }
@@ -263,8 +505,8 @@ public:
     }
 
     // Extension: JSON Visualization for CLI
-    void printTreeJSON() {
-        if (root == nullptr) {
+    void printTreeJSON() const {
+        if (root == NIL) {
             cout << "{}" << endl;
             return;
         }
@@ -272,24 +514,193 @@ public:
         cout << endl;
     }
 
-    // Extension: Fuzzy Search
-    void searchByPrefix(string prefix) {
+    // Ordered range scan: visit every node whose word is >= from, in order,
+    // until fn returns false. Costs O(log n) to position plus O(1) amortised
+    // per visited entry, using an explicit stack of pending nodes.
+    template <typename Fn>
+    void scanNodesFrom(string_view from, Fn fn) const {
+        NodeId stack[MAX_HEIGHT];
+        int top = 0;
+        // lower_bound: keep the nodes >= from whose left subtree we enter
+        for (NodeId node = root; node != NIL;) {
+            if (word(node) < from) {
+                node = nodes[node].right;
+            } else {
+                stack[top++] = node;
+                node = nodes[node].left;
+            }
+        }
+        scanStack(stack, top, fn);
+    }
+
+    // Same scan, starting from the entry of rank k (0-based) instead of a word
+    template <typename Fn>
+    void scanNodesFromRank(size_t k, Fn fn) const {
+        NodeId stack[MAX_HEIGHT];
+        int top = 0;
+        for (NodeId node = root; node != NIL;) {
+            size_t leftSize = subtreeSize(nodes[node].left);
+            if (k < leftSize) {
+                stack[top++] = node;
+                node = nodes[node].left;
+            } else if (k == leftSize) {
+                stack[top++] = node;
+                break;
+            } else {
+                k -= leftSize + 1;
+                node = nodes[node].right;
+            }
+        }
+        scanStack(stack, top, fn);
+    }
+
+    // Same scan, visiting (word, meaning)
+    template <typename Fn>
+    void scanFrom(string_view from, Fn fn) const {
+        scanNodesFrom(from, [&](NodeId node) { return fn(word(node), meaning(node)); });
+    }
+
+    // Visit every node id in word order
+    template <typename Fn>
+    void forEachNode(Fn fn) const {
+        scanNodesFrom("", [&](NodeId node) {
+            fn(node);
+            return true;
+        });
+    }
+
+    // Visit every (word, meaning) in word order
+    template <typename Fn>
+    void forEachEntry(Fn fn) const {
+        scanFrom("", [&](string_view w, string_view m) {
+            fn(w, m);
+            return true;
+        });
+    }
+
+    // Visit the words starting with prefix, skipping the first `offset`
+    // matches and stopping after `limit`: a scan from lower_bound(prefix) to
+    // the first word without the prefix. Returns the number visited.
+    template <typename Fn>
+    size_t forEachPrefix(string_view prefix, size_t offset, size_t limit, Fn fn) const {
+        size_t visited = 0;
+        if (limit == 0) return 0;
+        scanFrom(prefix, [&](string_view w, string_view m) {
+            if (w.substr(0, prefix.size()) != prefix) return false;
+            if (offset > 0) {
+                offset--;
+                return true;
+            }
+            fn(w, m);
+            return ++visited < limit;
+        });
+        return visited;
+    }
+
+    // Order statistics: the entry of rank k (0-based), or NIL if k >= size()
+    NodeId select(size_t k) const {
+        NodeId node = root;
+        while (node != NIL) {
+            size_t leftSize = subtreeSize(nodes[node].left);
+            if (k == leftSize) return node;
+            if (k < leftSize) {
+                node = nodes[node].left;
+            } else {
+                k -= leftSize + 1;
+                node = nodes[node].right;
+            }
+        }
+        return NIL;
+    }
+
+    // Number of words that sort before word (or before-or-equal, if inclusive)
+    size_t rank(string_view word, bool inclusive = false) const {
+        size_t below = 0;
+        NodeId node = root;
+        while (node != NIL) {
+            int cmp = word.compare(this->word(node));
+            if (cmp < 0 || (cmp == 0 && !inclusive)) {
+                node = nodes[node].left;
+            } else {
+                below += subtreeSize(nodes[node].left) + 1;
+                node = nodes[node].right;
+            }
+        }
+        return below;
+    }
+
+    // Number of words w with lo <= w <= hi
+    size_t countRange(string_view lo, string_view hi) const {
+        if (hi < lo) return 0;
+        return rank(hi, true) - rank(lo);
+    }
+
+    // Visit (word, meaning) for entries [offset, offset + limit) in word
+    // order: O(log n) to find entry `offset`, then O(1) amortised per entry.
+    // Returns the number visited.
+    template <typename Fn>
+    size_t forEachInPage(size_t offset, size_t limit, Fn fn) const {
+        size_t visited = 0;
+        if (limit == 0 || offset >= size()) return 0;
+        scanNodesFromRank(offset, [&](NodeId node) {
+            fn(word(node), meaning(node));
+            return ++visited < limit;
+        });
+        return visited;
+    }
+
+    // Extension: Fuzzy Search (prefix matches, optionally one page of them)
+    void searchByPrefix(string_view prefix, size_t offset = 0, size_t limit = SIZE_MAX) const {
         cout << "Words starting with '" << prefix << "':" << endl;
         cout << "----------------------------------------" << endl;
-        searchByPrefix(root, prefix);
+        forEachPrefix(prefix, offset, limit, [](string_view w, string_view m) {
+            cout << left << setw(20) << w << ": " << m << endl;
+        });
         cout << "----------------------------------------" << endl;
     }
 
     // Extension: File I/O
-    void saveToFile(string filename) {
-        ofstream outFile(filename);
+    // Written to a temporary file, synced and renamed over filename (see
+    // replaceFile), so a crash never leaves a half-written or unsynced
+    // dictionary. Returns false on failure.
+    bool saveToFile(string filename) const {
+        string tmp = filename + ".tmp";
+        ofstream outFile(tmp);
         if (!outFile) {
             cout << "Error opening file for writing: " << filename << endl;
-            return;
+            return false;
         }
         saveToFile(root, outFile);
         outFile.close();
+        if (!outFile || !replaceFile(tmp, filename)) {
+            cout << "Error writing file: " << filename << endl;
+            return false;
+        }
         cout << "Dictionary saved to " << filename << endl;
+        return true;
+    }
+
+    // Bulk load: replace the tree with a perfectly balanced one built from
+    // entries in any order. Sorted input (what saveToFile writes) is detected
+    // and built in a single linear pass; otherwise it is sorted once first.
+    // Duplicate words keep the last meaning, exactly as repeated insert() would,
+    // and entries already in the tree are kept unless the input overrides them.
+    void bulkLoad(vector<Entry> entries) {
+        sortUniqueEntries(entries);
+        if (root != NIL) {
+            // Merge with the current contents; the new entries override
+            vector<Entry> existing;
+            collect(root, existing);
+            entries = mergeEntries(move(existing), move(entries));
+        }
+
+        // Size the pool and arena exactly, then build in one pass
+        clear();
+        size_t bytes = 0;
+        for (const Entry& e : entries) bytes += e.first.size() + e.second.size();
+        nodes.reserve(entries.size());
+        strings.reserve(bytes);
+        root = buildBalanced(entries, 0, entries.size());
     }
 
     void loadFromFile(string filename) {
@@ -301,16 +712,18 @@ public:
 
         string line;
         int count = 0;
+        vector<Entry> entries;
         while (getline(inFile, line)) {
             size_t delimiterPos = line.find(':');
             if (delimiterPos != string::npos) {
                 string word = line.substr(0, delimiterPos);
                 string meaning = line.substr(delimiterPos + 1);
-                insert(word, meaning);
+                entries.emplace_back(move(word), move(meaning));
                 count++;
             }
         }
         inFile.close();
+        bulkLoad(move(entries));
         cout << "Loaded " << count << " entries from " << filename << endl;
     }
 };
@@ -0,0 +1,877 @@
+#ifndef BTREE_H
+#define BTREE_H
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <iomanip>
+#include <fstream>
+#include <filesystem>
+#include <algorithm>
+#include <vector>
+#include <utility>
+#include <optional>
+#include <cstdint>
+#include "Arena.h"
+#include "BST.h"
+#include "FileSync.h"
+
+using namespace std;
+
+// Keys per node. A node's prefix array is 32 * 8 bytes: four cache lines,
+// scanned front to back.
+const uint32_t BTREE_MAX_KEYS = 32;
+const uint32_t BTREE_MIN_KEYS = BTREE_MAX_KEYS / 2;
+// Prefix of the unused slots after the last key
+const uint64_t BTREE_NO_KEY = UINT64_MAX;
+
+// Leaf: up to 32 entries in word order, and the next leaf in word order
+struct alignas(64) BTreeLeaf {
+    uint64_t prefix[BTREE_MAX_KEYS]; // keyPrefix(word[i]); BTREE_NO_KEY past count
+    StrRef word[BTREE_MAX_KEYS];
+    StrRef meaning[BTREE_MAX_KEYS];
+    uint32_t count;
+    NodeId next; // NIL for the last leaf
+};
+
+// Inner node: child[i] holds the words below key[i], child[i + 1] the words
+// from key[i] up
+struct alignas(64) BTreeInner {
+    uint64_t prefix[BTREE_MAX_KEYS]; // keyPrefix(key[i]); BTREE_NO_KEY past count
+    StrRef key[BTREE_MAX_KEYS];
+    NodeId child[BTREE_MAX_KEYS + 1];
+    uint64_t entries[BTREE_MAX_KEYS + 1]; // entries under child[i]; 0 past count
+    uint32_t count;
+};
+
+// B+-tree dictionary backend
+//
+// Entries live only in the leaves, 16 to 32 per node, and the leaves are
+// chained in word order; inner nodes hold separator keys only. A lookup in
+// a million-entry tree therefore visits four or five wide nodes instead of
+// about twenty binary nodes, and ordered output, prefix search and paging
+// walk the leaf chain sequentially. Inner nodes also count the entries under
+// each child, so a page at any offset is found in one descent.
+//
+// Every node keeps the first 8 bytes of each key as a big-endian integer
+// (keyPrefix). Searching a node counts the prefixes below and equal to the
+// query's with one fixed-length, branch-free loop over the padded array,
+// which the compiler turns into SIMD compares; the arena bytes are only read
+// for the few keys whose prefix ties with the query.
+//
+// Nodes are kept in two NodePools and linked by 32-bit index; word, meaning
+// and separator bytes share one StringArena (see Arena.h). Separators are
+// copies, so removing a word never invalidates one.
+class BTree {
+private:
+    // Inner levels for up to 2^32 entries: 16 * 17^k > 2^32 for k = 7
+    static const int MAX_LEVELS = 16;
+
+    NodePool<BTreeLeaf> leaves;
+    NodePool<BTreeInner> inners;
+    StringArena strings;
+    NodeId root;     // a leaf if innerLevels == 0
+    int innerLevels; // inner levels above the leaves
+    size_t count;
+
+    static BTreeLeaf emptyLeaf() {
+        BTreeLeaf leaf;
+        fill(begin(leaf.prefix), end(leaf.prefix), BTREE_NO_KEY);
+        leaf.count = 0;
+        leaf.next = NIL;
+        return leaf;
+    }
+
+    static BTreeInner emptyInner() {
+        BTreeInner inner;
+        fill(begin(inner.prefix), end(inner.prefix), BTREE_NO_KEY);
+        fill(begin(inner.child), end(inner.child), NIL);
+        fill(begin(inner.entries), end(inner.entries), 0);
+        inner.count = 0;
+        return inner;
+    }
+
+    string_view str(StrRef ref) const { return strings.get(ref); }
+
+    // Entries under a node, from its own counts
+    size_t entriesUnder(NodeId node, bool leafLevel) const {
+        if (leafLevel) return leaves[node].count;
+        const BTreeInner& inner = inners[node];
+        size_t total = 0;
+        for (uint32_t i = 0; i <= inner.count; i++) total += inner.entries[i];
+        return total;
+    }
+
+    // Helper: Number of keys with a prefix below p (lo) and at or below p (hi).
+    // Always scans all BTREE_MAX_KEYS slots: the padding never counts, and a
+    // fixed trip count without branches vectorises.
+    static void prefixBounds(const uint64_t* prefix, uint32_t keys, uint64_t p, uint32_t& lo, uint32_t& hi) {
+        uint32_t below = 0, atOrBelow = 0;
+        for (uint32_t i = 0; i < BTREE_MAX_KEYS; i++) {
+            below += prefix[i] < p;
+            atOrBelow += prefix[i] <= p;
+        }
+        lo = below;
+        hi = min(atOrBelow, keys); // only a query of eight 0xFF bytes counts padding
+    }
+
+    // Position of the first entry >= word in a leaf
+    uint32_t lowerBound(const BTreeLeaf& leaf, string_view word) const {
+        uint32_t lo, hi;
+        prefixBounds(leaf.prefix, leaf.count, keyPrefix(word), lo, hi);
+        while (lo < hi && str(leaf.word[lo]) < word) lo++;
+        return lo;
+    }
+
+    // Child of an inner node to descend into for word (number of keys <= word)
+    uint32_t childIndex(const BTreeInner& inner, string_view word) const {
+        uint32_t lo, hi;
+        prefixBounds(inner.prefix, inner.count, keyPrefix(word), lo, hi);
+        while (lo < hi && str(inner.key[lo]) <= word) lo++;
+        return lo;
+    }
+
+    NodeId findLeaf(string_view word) const {
+        NodeId node = root;
+        for (int level = innerLevels; level > 0; level--) node = inners[node].child[childIndex(inners[node], word)];
+        return node;
+    }
+
+    NodeId firstLeaf() const {
+        NodeId node = root;
+        for (int level = innerLevels; level > 0; level--) node = inners[node].child[0];
+        return node;
+    }
+
+    // Helper: Copy a string of this arena into it again (add() may reallocate
+    // the bytes it is reading, so go through a temporary)
+    StrRef copyString(StrRef ref) {
+        string s(str(ref));
+        return strings.add(s);
+    }
+
+    // Helper: Shift entries [pos, count) of a leaf and put one entry at pos
+    static void leafInsertAt(BTreeLeaf& leaf, uint32_t pos, uint64_t prefix, StrRef word, StrRef meaning) {
+        for (uint32_t i = leaf.count; i > pos; i--) {
+            leaf.prefix[i] = leaf.prefix[i - 1];
+            leaf.word[i] = leaf.word[i - 1];
+            leaf.meaning[i] = leaf.meaning[i - 1];
+        }
+        leaf.prefix[pos] = prefix;
+        leaf.word[pos] = word;
+        leaf.meaning[pos] = meaning;
+        leaf.count++;
+    }
+
+    static void leafEraseAt(BTreeLeaf& leaf, uint32_t pos) {
+        for (uint32_t i = pos; i + 1 < leaf.count; i++) {
+            leaf.prefix[i] = leaf.prefix[i + 1];
+            leaf.word[i] = leaf.word[i + 1];
+            leaf.meaning[i] = leaf.meaning[i + 1];
+        }
+        leaf.count--;
+        leaf.prefix[leaf.count] = BTREE_NO_KEY;
+    }
+
+    // Helper: Put key at pos and its right-hand child, holding rightEntries
+    // entries, at pos + 1
+    static void innerInsertAt(BTreeInner& inner, uint32_t pos, uint64_t prefix, StrRef key, NodeId right,
+                              size_t rightEntries) {
+        for (uint32_t i = inner.count; i > pos; i--) {
+            inner.prefix[i] = inner.prefix[i - 1];
+            inner.key[i] = inner.key[i - 1];
+            inner.child[i + 1] = inner.child[i];
+            inner.entries[i + 1] = inner.entries[i];
+        }
+        inner.prefix[pos] = prefix;
+        inner.key[pos] = key;
+        inner.child[pos + 1] = right;
+        inner.entries[pos + 1] = rightEntries;
+        inner.count++;
+    }
+
+    // Remove key pos and its right-hand child pos + 1
+    static void innerEraseAt(BTreeInner& inner, uint32_t pos) {
+        for (uint32_t i = pos; i + 1 < inner.count; i++) {
+            inner.prefix[i] = inner.prefix[i + 1];
+            inner.key[i] = inner.key[i + 1];
+            inner.child[i + 1] = inner.child[i + 2];
+            inner.entries[i + 1] = inner.entries[i + 2];
+        }
+        inner.count--;
+        inner.prefix[inner.count] = BTREE_NO_KEY;
+        inner.child[inner.count + 1] = NIL;
+        inner.entries[inner.count + 1] = 0;
+    }
+
+    // Helper: Split a full leaf while inserting an entry at pos. The new right
+    // leaf is returned; its first word becomes the separator.
+    NodeId splitLeaf(NodeId id, uint32_t pos, uint64_t prefix, StrRef word, StrRef meaning) {
+        const uint32_t total = BTREE_MAX_KEYS + 1;
+        uint64_t p[total];
+        StrRef w[total], m[total];
+        const BTreeLeaf& full = leaves[id];
+        for (uint32_t i = 0, j = 0; i < total; i++) {
+            if (i == pos) {
+                p[i] = prefix;
+                w[i] = word;
+                m[i] = meaning;
+            } else {
+                p[i] = full.prefix[j];
+                w[i] = full.word[j];
+                m[i] = full.meaning[j];
+                j++;
+            }
+        }
+
+        NodeId rightId = leaves.alloc(emptyLeaf());
+        BTreeLeaf& left = leaves[id];
+        BTreeLeaf& right = leaves[rightId];
+        uint32_t half = total / 2;
+        left.count = half;
+        right.count = total - half;
+        for (uint32_t i = 0; i < BTREE_MAX_KEYS; i++) {
+            left.prefix[i] = i < half ? p[i] : BTREE_NO_KEY;
+            left.word[i] = w[i];
+            left.meaning[i] = m[i];
+        }
+        for (uint32_t i = 0; i < right.count; i++) {
+            right.prefix[i] = p[half + i];
+            right.word[i] = w[half + i];
+            right.meaning[i] = m[half + i];
+        }
+        right.next = left.next;
+        left.next = rightId;
+        return rightId;
+    }
+
+    // Helper: Split a full inner node while inserting (key, right child) at
+    // pos. The middle key moves up: it is returned through key/prefix, and
+    // the new right node is returned.
+    NodeId splitInner(NodeId id, uint32_t pos, uint64_t& prefix, StrRef& key, NodeId child, size_t childEntries) {
+        const uint32_t total = BTREE_MAX_KEYS + 1;
+        uint64_t p[total];
+        StrRef k[total];
+        NodeId c[total + 1];
+        uint64_t e[total + 1];
+        const BTreeInner& full = inners[id];
+        c[0] = full.child[0];
+        e[0] = full.entries[0];
+        for (uint32_t i = 0, j = 0; i < total; i++) {
+            if (i == pos) {
+                p[i] = prefix;
+                k[i] = key;
+                c[i + 1] = child;
+                e[i + 1] = childEntries;
+            } else {
+                p[i] = full.prefix[j];
+                k[i] = full.key[j];
+                c[i + 1] = full.child[j + 1];
+                e[i + 1] = full.entries[j + 1];
+                j++;
+            }
+        }
+
+        NodeId rightId = inners.alloc(emptyInner());
+        BTreeInner& left = inners[id];
+        BTreeInner& right = inners[rightId];
+        uint32_t half = total / 2;
+        left.count = half;
+        right.count = total - half - 1;
+        for (uint32_t i = 0; i < BTREE_MAX_KEYS; i++) {
+            left.prefix[i] = i < half ? p[i] : BTREE_NO_KEY;
+            left.key[i] = k[i];
+            left.child[i + 1] = i < half ? c[i + 1] : NIL;
+            left.entries[i + 1] = i < half ? e[i + 1] : 0;
+        }
+        for (uint32_t i = 0; i < right.count; i++) {
+            right.prefix[i] = p[half + 1 + i];
+            right.key[i] = k[half + 1 + i];
+            right.child[i] = c[half + 1 + i];
+            right.entries[i] = e[half + 1 + i];
+        }
+        right.child[right.count] = c[total];
+        right.entries[right.count] = e[total];
+        prefix = p[half];
+        key = k[half];
+        return rightId;
+    }
+
+    // Helper: Repair node `slot` of parent after it dropped below
+    // BTREE_MIN_KEYS, by borrowing one entry from a sibling through the
+    // separator or, if the two fit in one node, merging them, and recount
+    // the pair in the parent. Returns true if the parent lost a key (a merge).
+    bool rebalance(NodeId parent, uint32_t slot, bool leafLevel) {
+        BTreeInner& p = inners[parent];
+        // Pair the node with its left sibling if it has one, else its right
+        uint32_t sep = slot > 0 ? slot - 1 : slot;
+        NodeId l = p.child[sep], r = p.child[sep + 1];
+        bool fromRight = slot == sep; // the underfull node is the left one
+
+        if (leafLevel) {
+            BTreeLeaf& left = leaves[l];
+            BTreeLeaf& right = leaves[r];
+            if (left.count + right.count <= BTREE_MAX_KEYS) {
+                for (uint32_t i = 0; i < right.count; i++) {
+                    leafInsertAt(left, left.count, right.prefix[i], right.word[i], right.meaning[i]);
+                }
+                left.next = right.next;
+                leaves.release(r);
+                strings.release(p.key[sep]);
+                innerEraseAt(p, sep);
+                p.entries[sep] = left.count;
+                return true;
+            }
+            if (fromRight) {
+                leafInsertAt(left, left.count, right.prefix[0], right.word[0], right.meaning[0]);
+                leafEraseAt(right, 0);
+            } else {
+                uint32_t last = left.count - 1;
+                leafInsertAt(right, 0, left.prefix[last], left.word[last], left.meaning[last]);
+                leafEraseAt(left, last);
+            }
+            strings.release(p.key[sep]);
+            StrRef first = leaves[r].word[0];
+            uint64_t firstPrefix = leaves[r].prefix[0];
+            StrRef key = copyString(first);
+            inners[parent].key[sep] = key;
+            inners[parent].prefix[sep] = firstPrefix;
+            inners[parent].entries[sep] = leaves[l].count;
+            inners[parent].entries[sep + 1] = leaves[r].count;
+            return false;
+        }
+
+        BTreeInner& left = inners[l];
+        BTreeInner& right = inners[r];
+        if (left.count + right.count + 1 <= BTREE_MAX_KEYS) {
+            // The separator comes down between the two halves
+            innerInsertAt(left, left.count, p.prefix[sep], p.key[sep], right.child[0], right.entries[0]);
+            for (uint32_t i = 0; i < right.count; i++) {
+                innerInsertAt(left, left.count, right.prefix[i], right.key[i], right.child[i + 1],
+                              right.entries[i + 1]);
+            }
+            inners.release(r);
+            innerEraseAt(p, sep);
+            p.entries[sep] = entriesUnder(l, false);
+            return true;
+        }
+        if (fromRight) {
+            // Rotate left: separator down into left, right's first key up
+            innerInsertAt(left, left.count, p.prefix[sep], p.key[sep], right.child[0], right.entries[0]);
+            p.prefix[sep] = right.prefix[0];
+            p.key[sep] = right.key[0];
+            right.child[0] = right.child[1];
+            right.entries[0] = right.entries[1];
+            innerEraseAt(right, 0);
+        } else {
+            // Rotate right: separator down into right, left's last key up
+            uint32_t last = left.count - 1;
+            NodeId moved = left.child[last + 1];
+            uint64_t movedEntries = left.entries[last + 1];
+            for (uint32_t i = right.count; i > 0; i--) {
+                right.prefix[i] = right.prefix[i - 1];
+                right.key[i] = right.key[i - 1];
+            }
+            for (uint32_t i = right.count + 1; i > 0; i--) {
+                right.child[i] = right.child[i - 1];
+                right.entries[i] = right.entries[i - 1];
+            }
+            right.prefix[0] = p.prefix[sep];
+            right.key[0] = p.key[sep];
+            right.child[0] = moved;
+            right.entries[0] = movedEntries;
+            right.count++;
+            p.prefix[sep] = left.prefix[last];
+            p.key[sep] = left.key[last];
+            innerEraseAt(left, last);
+        }
+        p.entries[sep] = entriesUnder(l, false);
+        p.entries[sep + 1] = entriesUnder(r, false);
+        return false;
+    }
+
+    // Helper: Rewrite the string arena once more than half of it is garbage
+    // (every live string is reached from the root)
+    void compactStrings() {
+        if (strings.garbageBytes() < 4096 || strings.garbageBytes() * 2 < strings.size()) return;
+        StringArena fresh;
+        fresh.reserve(strings.size() - strings.garbageBytes());
+        vector<pair<NodeId, int>> stack{{root, innerLevels}};
+        while (!stack.empty()) {
+            auto [node, level] = stack.back();
+            stack.pop_back();
+            if (level == 0) {
+                BTreeLeaf& leaf = leaves[node];
+                for (uint32_t i = 0; i < leaf.count; i++) {
+                    leaf.word[i] = fresh.add(str(leaf.word[i]));
+                    leaf.meaning[i] = fresh.add(str(leaf.meaning[i]));
+                }
+                continue;
+            }
+            BTreeInner& inner = inners[node];
+            for (uint32_t i = 0; i < inner.count; i++) inner.key[i] = fresh.add(str(inner.key[i]));
+            for (uint32_t i = 0; i <= inner.count; i++) stack.push_back({inner.child[i], level - 1});
+        }
+        strings.swap(fresh);
+    }
+
+    // Helper: Validate a subtree: fill, key order, stored prefixes and
+    // padding, child entry counts, and that every word lies in [lo, hi). Leaves are appended to
+    // order so the chain can be checked against them.
+    bool checkNode(NodeId node, int level, const string_view* lo, const string_view* hi, size_t& entries,
+                   vector<NodeId>& order) const {
+        bool isRoot = node == root;
+        if (level == 0) {
+            const BTreeLeaf& leaf = leaves[node];
+            if (leaf.count > BTREE_MAX_KEYS || (!isRoot && leaf.count < BTREE_MIN_KEYS)) return false;
+            for (uint32_t i = 0; i < BTREE_MAX_KEYS; i++) {
+                if (i >= leaf.count) {
+                    if (leaf.prefix[i] != BTREE_NO_KEY) return false;
+                    continue;
+                }
+                string_view w = str(leaf.word[i]);
+                if (leaf.prefix[i] != keyPrefix(w)) return false;
+                if (i > 0 && !(str(leaf.word[i - 1]) < w)) return false;
+                if ((lo && w < *lo) || (hi && !(w < *hi))) return false;
+            }
+            entries += leaf.count;
+            order.push_back(node);
+            return true;
+        }
+        const BTreeInner& inner = inners[node];
+        if (inner.count > BTREE_MAX_KEYS || inner.count < (isRoot ? 1 : BTREE_MIN_KEYS)) return false;
+        for (uint32_t i = 0; i < BTREE_MAX_KEYS; i++) {
+            if (i >= inner.count) {
+                if (inner.prefix[i] != BTREE_NO_KEY) return false;
+                continue;
+            }
+            if (inner.prefix[i] != keyPrefix(str(inner.key[i]))) return false;
+            if (i > 0 && !(str(inner.key[i - 1]) < str(inner.key[i]))) return false;
+        }
+        for (uint32_t i = inner.count + 1; i <= BTREE_MAX_KEYS; i++) {
+            if (inner.entries[i] != 0) return false;
+        }
+        for (uint32_t i = 0; i <= inner.count; i++) {
+            string_view childLo = i > 0 ? str(inner.key[i - 1]) : string_view();
+            string_view childHi = i < inner.count ? str(inner.key[i]) : string_view();
+            size_t before = entries;
+            if (!checkNode(inner.child[i], level - 1, i > 0 ? &childLo : lo, i < inner.count ? &childHi : hi,
+                           entries, order)) {
+                return false;
+            }
+            if (inner.entries[i] != entries - before) return false;
+        }
+        return true;
+    }
+
+    // Helper: Print tree structure with indentation (inner nodes show their
+    // separators, leaves their words)
+    void printTree(NodeId node, int level, string indent, bool last) const {
+        cout << indent << (last ? "R----" : "L----");
+        indent += last ? "   " : "|  ";
+        if (level == 0) {
+            const BTreeLeaf& leaf = leaves[node];
+            cout << "(";
+            for (uint32_t i = 0; i < leaf.count; i++) cout << (i > 0 ? " " : "") << str(leaf.word[i]);
+            cout << ")" << endl;
+            return;
+        }
+        const BTreeInner& inner = inners[node];
+        cout << "[";
+        for (uint32_t i = 0; i < inner.count; i++) cout << (i > 0 ? " | " : "") << str(inner.key[i]);
+        cout << "]" << endl;
+        for (uint32_t i = 0; i <= inner.count; i++) printTree(inner.child[i], level - 1, indent, i == inner.count);
+    }
+
+    // Helper: Build the tree bottom-up from sorted, unique entries, spreading
+    // them evenly so that every node is at least half full
+    void build(const vector<Entry>& entries) {
+        // Current level: node ids, the index of each node's first entry and
+        // the entries under each node
+        vector<NodeId> level;
+        vector<size_t> firstEntry, levelEntries;
+        size_t n = entries.size();
+        size_t leafCount = max<size_t>(1, (n + BTREE_MAX_KEYS - 1) / BTREE_MAX_KEYS);
+        NodeId previous = NIL;
+        for (size_t k = 0; k < leafCount; k++) {
+            size_t from = n * k / leafCount, to = n * (k + 1) / leafCount;
+            NodeId id = leaves.alloc(emptyLeaf());
+            BTreeLeaf& leaf = leaves[id];
+            for (size_t i = from; i < to; i++) {
+                leaf.prefix[leaf.count] = keyPrefix(entries[i].first);
+                leaf.word[leaf.count] = strings.add(entries[i].first);
+                leaf.meaning[leaf.count] = strings.add(entries[i].second);
+                leaf.count++;
+            }
+            if (previous != NIL) leaves[previous].next = id;
+            previous = id;
+            level.push_back(id);
+            firstEntry.push_back(from);
+            levelEntries.push_back(to - from);
+        }
+
+        innerLevels = 0;
+        while (level.size() > 1) {
+            vector<NodeId> parents;
+            vector<size_t> parentFirst, parentEntries;
+            size_t m = level.size();
+            size_t parentCount = (m + BTREE_MAX_KEYS) / (BTREE_MAX_KEYS + 1);
+            for (size_t k = 0; k < parentCount; k++) {
+                size_t from = m * k / parentCount, to = m * (k + 1) / parentCount;
+                NodeId id = inners.alloc(emptyInner());
+                BTreeInner& inner = inners[id];
+                inner.child[0] = level[from];
+                inner.entries[0] = levelEntries[from];
+                size_t under = levelEntries[from];
+                for (size_t i = from + 1; i < to; i++) {
+                    const string& first = entries[firstEntry[i]].first;
+                    inner.prefix[inner.count] = keyPrefix(first);
+                    inner.key[inner.count] = strings.add(first);
+                    inner.child[inner.count + 1] = level[i];
+                    inner.entries[inner.count + 1] = levelEntries[i];
+                    under += levelEntries[i];
+                    inner.count++;
+                }
+                parents.push_back(id);
+                parentFirst.push_back(firstEntry[from]);
+                parentEntries.push_back(under);
+            }
+            level.swap(parents);
+            firstEntry.swap(parentFirst);
+            levelEntries.swap(parentEntries);
+            innerLevels++;
+        }
+        root = level[0];
+        count = n;
+    }
+
+public:
+    BTree() { clear(); }
+
+    // Drop every entry: the pools and arena are released wholesale
+    void clear() {
+        leaves.clear();
+        inners.clear();
+        strings.clear();
+        root = leaves.alloc(emptyLeaf());
+        innerLevels = 0;
+        count = 0;
+    }
+
+    size_t size() const { return count; }
+
+    // Height in nodes (a lone leaf is 1)
+    int height() const { return innerLevels + 1; }
+
+    // Heap bytes held by the node pools and string arena
+    size_t memoryBytes() const {
+        return sizeof(*this) + leaves.capacityBytes() + inners.capacityBytes() + strings.capacityBytes();
+    }
+
+    // Lookup: one prefix scan per level, no allocation.
+    // The view is valid until the next insert, remove or load.
+    optional<string_view> find(string_view word) const {
+        const BTreeLeaf& leaf = leaves[findLeaf(word)];
+        uint32_t pos = lowerBound(leaf, word);
+        if (pos < leaf.count && str(leaf.word[pos]) == word) return str(leaf.meaning[pos]);
+        return nullopt;
+    }
+
+    string search(string_view word) const {
+        optional<string_view> found = find(word);
+        return found ? string(*found) : "Word not found in the dictionary.";
+    }
+
+    // Insert or update. A full leaf splits in two and its separator goes up,
+    // splitting full inner nodes on the way; a root split adds a level.
+    // (word and meaning must not point into this tree's own storage)
+    void insert(string_view word, string_view meaning) {
+        NodeId path[MAX_LEVELS];
+        uint32_t slot[MAX_LEVELS];
+        NodeId node = root;
+        for (int d = 0; d < innerLevels; d++) {
+            path[d] = node;
+            slot[d] = childIndex(inners[node], word);
+            node = inners[node].child[slot[d]];
+        }
+
+        BTreeLeaf& leaf = leaves[node];
+        uint32_t pos = lowerBound(leaf, word);
+        if (pos < leaf.count && str(leaf.word[pos]) == word) {
+            // Word already exists, update meaning
+            strings.release(leaf.meaning[pos]);
+            leaf.meaning[pos] = strings.add(meaning);
+            compactStrings();
+            return;
+        }
+        count++;
+        for (int d = 0; d < innerLevels; d++) inners[path[d]].entries[slot[d]]++;
+        uint64_t prefix = keyPrefix(word);
+        StrRef w = strings.add(word);
+        StrRef m = strings.add(meaning);
+        if (leaf.count < BTREE_MAX_KEYS) {
+            leafInsertAt(leaf, pos, prefix, w, m);
+            return;
+        }
+
+        // Each split hands the parent a new right node; both halves are
+        // recounted there
+        NodeId right = splitLeaf(node, pos, prefix, w, m);
+        StrRef key = copyString(leaves[right].word[0]);
+        prefix = leaves[right].prefix[0];
+        size_t leftEntries = leaves[node].count, rightEntries = leaves[right].count;
+        for (int d = innerLevels - 1; d >= 0; d--) {
+            BTreeInner& parent = inners[path[d]];
+            parent.entries[slot[d]] = leftEntries;
+            if (parent.count < BTREE_MAX_KEYS) {
+                innerInsertAt(parent, slot[d], prefix, key, right, rightEntries);
+                return;
+            }
+            right = splitInner(path[d], slot[d], prefix, key, right, rightEntries);
+            leftEntries = entriesUnder(path[d], false);
+            rightEntries = entriesUnder(right, false);
+        }
+
+        // The root split: a new root with one separator
+        NodeId newRoot = inners.alloc(emptyInner());
+        BTreeInner& top = inners[newRoot];
+        top.prefix[0] = prefix;
+        top.key[0] = key;
+        top.child[0] = root;
+        top.child[1] = right;
+        top.entries[0] = leftEntries;
+        top.entries[1] = rightEntries;
+        top.count = 1;
+        root = newRoot;
+        innerLevels++;
+    }
+
+    // Remove a word. An underfull node borrows from or merges with a sibling,
+    // bottom-up; a root inner node left without keys is replaced by its child.
+    void remove(string_view word) {
+        NodeId path[MAX_LEVELS];
+        uint32_t slot[MAX_LEVELS];
+        NodeId node = root;
+        for (int d = 0; d < innerLevels; d++) {
+            path[d] = node;
+            slot[d] = childIndex(inners[node], word);
+            node = inners[node].child[slot[d]];
+        }
+
+        BTreeLeaf& leaf = leaves[node];
+        uint32_t pos = lowerBound(leaf, word);
+        if (pos >= leaf.count || str(leaf.word[pos]) != word) {
+            cout << "Word '" << word << "' not found." << endl;
+            return;
+        }
+        strings.release(leaf.word[pos]);
+        strings.release(leaf.meaning[pos]);
+        leafEraseAt(leaf, pos);
+        count--;
+        for (int d = 0; d < innerLevels; d++) inners[path[d]].entries[slot[d]]--;
+
+        bool underfull = leaf.count < BTREE_MIN_KEYS;
+        for (int d = innerLevels - 1; d >= 0 && underfull; d--) {
+            if (!rebalance(path[d], slot[d], d == innerLevels - 1)) break;
+            underfull = inners[path[d]].count < BTREE_MIN_KEYS;
+        }
+        if (innerLevels > 0 && inners[root].count == 0) {
+            NodeId only = inners[root].child[0];
+            inners.release(root);
+            root = only;
+            innerLevels--;
+        }
+        compactStrings();
+    }
+
+    // Ordered range scan: visit every (word, meaning) with word >= from, in
+    // order, until fn returns false. One descent, then the leaf chain.
+    template <typename Fn>
+    void scanFrom(string_view from, Fn fn) const {
+        NodeId node = findLeaf(from);
+        uint32_t pos = lowerBound(leaves[node], from);
+        for (; node != NIL; node = leaves[node].next, pos = 0) {
+            const BTreeLeaf& leaf = leaves[node];
+            for (; pos < leaf.count; pos++) {
+                if (!fn(str(leaf.word[pos]), str(leaf.meaning[pos]))) return;
+            }
+        }
+    }
+
+    // Visit every (word, meaning) in word order
+    template <typename Fn>
+    void forEachEntry(Fn fn) const {
+        for (NodeId node = firstLeaf(); node != NIL; node = leaves[node].next) {
+            const BTreeLeaf& leaf = leaves[node];
+            for (uint32_t i = 0; i < leaf.count; i++) fn(str(leaf.word[i]), str(leaf.meaning[i]));
+        }
+    }
+
+    // Visit the words starting with prefix, skipping the first `offset`
+    // matches and stopping after `limit`. Returns the number visited.
+    template <typename Fn>
+    size_t forEachPrefix(string_view prefix, size_t offset, size_t limit, Fn fn) const {
+        size_t visited = 0;
+        if (limit == 0) return 0;
+        scanFrom(prefix, [&](string_view w, string_view m) {
+            if (w.substr(0, prefix.size()) != prefix) return false;
+            if (offset > 0) {
+                offset--;
+                return true;
+            }
+            fn(w, m);
+            return ++visited < limit;
+        });
+        return visited;
+    }
+
+    // Visit entries [offset, offset + limit) in word order. The descent
+    // skips whole subtrees by their entry counts, so a page costs
+    // O(log n + limit) at any offset. Returns the number visited.
+    template <typename Fn>
+    size_t forEachInPage(size_t offset, size_t limit, Fn fn) const {
+        size_t visited = 0;
+        if (offset >= count) return 0;
+        NodeId node = root;
+        for (int level = innerLevels; level > 0; level--) {
+            const BTreeInner& inner = inners[node];
+            uint32_t i = 0;
+            while (i < inner.count && offset >= inner.entries[i]) offset -= inner.entries[i++];
+            node = inner.child[i];
+        }
+        for (size_t pos = offset; node != NIL && visited < limit; node = leaves[node].next, pos = 0) {
+            const BTreeLeaf& leaf = leaves[node];
+            for (; pos < leaf.count && visited < limit; pos++, visited++) {
+                fn(str(leaf.word[pos]), str(leaf.meaning[pos]));
+            }
+        }
+        return visited;
+    }
+
+    void inOrder() const {
+        if (count == 0) {
+            cout << "Dictionary is empty." << endl;
+        } else {
+            cout << "----------------------------------------" << endl;
+            cout << left << setw(20) << "Word" << "Meaning" << endl;
+            cout << "----------------------------------------" << endl;
+            forEachEntry([](string_view w, string_view m) { cout << left << setw(20) << w << ": " << m << endl; });
+            cout << "----------------------------------------" << endl;
+        }
+    }
+
+    // Extension: Fuzzy Search (prefix matches, optionally one page of them)
+    void searchByPrefix(string_view prefix, size_t offset = 0, size_t limit = SIZE_MAX) const {
+        cout << "Words starting with '" << prefix << "':" << endl;
+        cout << "----------------------------------------" << endl;
+        forEachPrefix(prefix, offset, limit, [](string_view w, string_view m) {
+            cout << left << setw(20) << w << ": " << m << endl;
+        });
+        cout << "----------------------------------------" << endl;
+    }
+
+    // Structure check (used by the check_tree CLI command): node fill, key
+    // order, stored prefixes, separator bounds, uniform leaf depth and the
+    // leaf chain.
+    bool checkTree() const {
+        size_t entries = 0;
+        vector<NodeId> order;
+        bool ok = checkNode(root, innerLevels, nullptr, nullptr, entries, order);
+        if (ok) {
+            // The chain must link the leaves in the order the tree holds them
+            size_t i = 0;
+            for (NodeId node = firstLeaf(); node != NIL && ok; node = leaves[node].next, i++) {
+                ok = i < order.size() && order[i] == node;
+            }
+            ok = ok && i == order.size();
+        }
+        if (!ok) {
+            cout << "B-tree check FAILED: fill, order, prefix or leaf chain invalid" << endl;
+            return false;
+        }
+        cout << "Entries: " << entries << ", height: " << height() << ", leaves: " << leaves.size()
+             << ", inner nodes: " << inners.size() << endl;
+        if (entries != count) {
+            cout << "B-tree check FAILED: " << count << " entries recorded" << endl;
+            return false;
+        }
+        cout << "B-tree check OK" << endl;
+        return true;
+    }
+
+    // Extension: Visualization
+    void printTree() const {
+        if (count == 0) {
+            cout << "Tree is empty." << endl;
+            return;
+        }
+        printTree(root, innerLevels, "", true);
+    }
+
+    // Extension: File I/O
+    // Written to a temporary file, synced and renamed over filename (see
+    // replaceFile), so a crash never leaves a half-written or unsynced
+    // dictionary. Returns false on failure.
+    bool saveToFile(string filename) const {
+        string tmp = filename + ".tmp";
+        ofstream outFile(tmp);
+        if (!outFile) {
+            cout << "Error opening file for writing: " << filename << endl;
+            return false;
+        }
+        forEachEntry([&](string_view w, string_view m) { outFile << w << ":" << m << "\n"; });
+        outFile.close();
+        if (!outFile || !replaceFile(tmp, filename)) {
+            cout << "Error writing file: " << filename << endl;
+            return false;
+        }
+        cout << "Dictionary saved to " << filename << endl;
+        return true;
+    }
+
+    // Bulk load: replace the tree with one built bottom-up from entries in
+    // any order, with the same duplicate and merge rules as BST::bulkLoad
+    void bulkLoad(vector<Entry> entries) {
+        sortUniqueEntries(entries);
+        if (count > 0) {
+            vector<Entry> existing;
+            existing.reserve(count);
+            forEachEntry([&](string_view w, string_view m) { existing.emplace_back(string(w), string(m)); });
+            entries = mergeEntries(move(existing), move(entries));
+        }
+
+        // Size the pools and arena for the build, then build in one pass
+        leaves.clear();
+        inners.clear();
+        strings.clear();
+        size_t bytes = 0;
+        for (const Entry& e : entries) bytes += e.first.size() + e.second.size();
+        leaves.reserve(entries.size() / BTREE_MAX_KEYS + 1);
+        strings.reserve(bytes + bytes / BTREE_MIN_KEYS);
+        build(entries);
+    }
+
+    void loadFromFile(string filename) {
+        ifstream inFile(filename);
+        if (!inFile) {
+            cout << "Error opening file for reading: " << filename << endl;
+            return;
+        }
+
+        string line;
+        int lines = 0;
+        vector<Entry> entries;
+        while (getline(inFile, line)) {
+            size_t delimiterPos = line.find(':');
+            if (delimiterPos != string::npos) {
+                entries.emplace_back(line.substr(0, delimiterPos), line.substr(delimiterPos + 1));
+                lines++;
+            }
+        }
+        inFile.close();
+        bulkLoad(move(entries));
+        cout << "Loaded " << lines << " entries from " << filename << endl;
+    }
+};
+
+#endif // BTREE_H
@@ -0,0 +1,350 @@
+#ifndef CONCURRENT_DICTIONARY_H
+#define CONCURRENT_DICTIONARY_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <algorithm>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+#include <cstdlib>
+#include "BST.h"
+
+// --- Concurrent dictionary: lock-free readers, copy-on-write updates ---
+//
+// The tree is a persistent AVL tree: nodes are never modified once they are
+// reachable. A writer copies the nodes on the path it changes (O(log n) new
+// nodes, sharing every other subtree with the old version) and publishes the
+// new root with one atomic store. Readers load the root and search an
+// immutable version without taking any lock; they can never see a
+// half-applied rotation or the successor copy of a remove.
+//
+// Writers are serialised by a mutex. The nodes and entries a write replaced
+// are retired, not freed: memory is reclaimed with epochs. A reader
+// announces the global epoch in its slot before loading the root, and a
+// batch retired in epoch e is freed once every active reader announced an
+// epoch after e (those readers loaded a root that no longer reaches it).
+class ConcurrentDictionary {
+public:
+    static const int MAX_READERS = 64;
+
+private:
+    // Word and meaning, shared by every version of the node that holds them
+    struct PEntry {
+        std::string word;
+        std::string meaning;
+    };
+
+    // word views entry->word, so a search step touches the node and the bytes
+    struct PNode {
+        std::string_view word;
+        const PEntry* entry;
+        const PNode* left;
+        const PNode* right;
+        int height;
+    };
+
+    // One reader slot per cache line; 0 means the reader is outside a read
+    struct alignas(64) ReaderSlot {
+        std::atomic<uint64_t> epoch{0};
+        std::atomic<bool> claimed{false};
+    };
+
+    struct RetiredBatch {
+        uint64_t epoch;
+        std::vector<const PNode*> nodes;
+        std::vector<const PEntry*> entries;
+    };
+
+    std::atomic<const PNode*> root{nullptr};
+    std::atomic<uint64_t> globalEpoch{1};
+    ReaderSlot slots[MAX_READERS];
+
+    std::mutex writeLock;
+    std::size_t count = 0;            // guarded by writeLock
+    std::vector<RetiredBatch> retired; // guarded by writeLock
+    RetiredBatch pending;              // replaced by the write in progress
+
+    // --- Writer side (writeLock held) ---
+
+    static int height(const PNode* node) { return node == nullptr ? 0 : node->height; }
+
+    const PNode* make(const PEntry* entry, const PNode* left, const PNode* right) {
+        return new PNode{entry->word, entry, left, right, 1 + std::max(height(left), height(right))};
+    }
+
+    // Build a balanced node from (entry, left, right) whose subtrees differ in
+    // height by at most two, rotating on fresh nodes only
+    const PNode* balance(const PEntry* entry, const PNode* left, const PNode* right) {
+        int diff = height(left) - height(right);
+        if (diff > 1) {
+            if (height(left->left) < height(left->right)) {
+                // Left-Right case
+                const PNode* lr = left->right;
+                pending.nodes.push_back(left);
+                pending.nodes.push_back(lr);
+                return make(lr->entry, make(left->entry, left->left, lr->left), make(entry, lr->right, right));
+            }
+            pending.nodes.push_back(left);
+            return make(left->entry, left->left, make(entry, left->right, right));
+        }
+        if (diff < -1) {
+            if (height(right->right) < height(right->left)) {
+                // Right-Left case
+                const PNode* rl = right->left;
+                pending.nodes.push_back(right);
+                pending.nodes.push_back(rl);
+                return make(rl->entry, make(entry, left, rl->left), make(right->entry, rl->right, right->right));
+            }
+            pending.nodes.push_back(right);
+            return make(right->entry, make(entry, left, right->left), right->right);
+        }
+        return make(entry, left, right);
+    }
+
+    const PNode* insertAt(const PNode* node, const PEntry* entry) {
+        if (node == nullptr) {
+            count++;
+            return make(entry, nullptr, nullptr);
+        }
+        int cmp = std::string_view(entry->word).compare(node->word);
+        pending.nodes.push_back(node);
+        if (cmp == 0) {
+            // Word already exists: same shape, new entry
+            pending.entries.push_back(node->entry);
+            return make(entry, node->left, node->right);
+        }
+        if (cmp < 0) return balance(node->entry, insertAt(node->left, entry), node->right);
+        return balance(node->entry, node->left, insertAt(node->right, entry));
+    }
+
+    // Remove the smallest node of a non-empty subtree; its entry goes to minEntry
+    const PNode* removeMin(const PNode* node, const PEntry*& minEntry) {
+        pending.nodes.push_back(node);
+        if (node->left == nullptr) {
+            minEntry = node->entry;
+            return node->right;
+        }
+        return balance(node->entry, removeMin(node->left, minEntry), node->right);
+    }
+
+    const PNode* removeAt(const PNode* node, std::string_view word, bool& found) {
+        if (node == nullptr) return nullptr;
+        int cmp = word.compare(node->word);
+        if (cmp < 0) {
+            const PNode* left = removeAt(node->left, word, found);
+            if (!found) return node;
+            pending.nodes.push_back(node);
+            return balance(node->entry, left, node->right);
+        }
+        if (cmp > 0) {
+            const PNode* right = removeAt(node->right, word, found);
+            if (!found) return node;
+            pending.nodes.push_back(node);
+            return balance(node->entry, node->left, right);
+        }
+        found = true;
+        count--;
+        pending.nodes.push_back(node);
+        pending.entries.push_back(node->entry);
+        if (node->left == nullptr) return node->right;
+        if (node->right == nullptr) return node->left;
+        // Two children: the successor's entry moves up into a fresh node
+        const PEntry* successor = nullptr;
+        const PNode* right = removeMin(node->right, successor);
+        return balance(successor, node->left, right);
+    }
+
+    const PNode* buildBalanced(const std::vector<const PEntry*>& entries, std::size_t lo, std::size_t hi) {
+        if (lo >= hi) return nullptr;
+        std::size_t mid = lo + (hi - lo) / 2;
+        const PNode* left = buildBalanced(entries, lo, mid);
+        const PNode* right = buildBalanced(entries, mid + 1, hi);
+        return make(entries[mid], left, right);
+    }
+
+    // Publish newRoot, retire what the write replaced and free old batches
+    void publish(const PNode* newRoot) {
+        root.store(newRoot, std::memory_order_seq_cst);
+        uint64_t epoch = globalEpoch.load(std::memory_order_relaxed);
+        if (!pending.nodes.empty() || !pending.entries.empty()) {
+            pending.epoch = epoch;
+            retired.push_back(std::move(pending));
+            pending = RetiredBatch();
+        }
+        globalEpoch.store(epoch + 1, std::memory_order_seq_cst);
+        reclaim();
+    }
+
+    void reclaim() {
+        uint64_t oldest = UINT64_MAX;
+        for (const ReaderSlot& slot : slots) {
+            uint64_t e = slot.epoch.load(std::memory_order_seq_cst);
+            if (e != 0) oldest = std::min(oldest, e);
+        }
+        std::size_t freed = 0;
+        while (freed < retired.size() && retired[freed].epoch < oldest) {
+            for (const PNode* node : retired[freed].nodes) delete node;
+            for (const PEntry* entry : retired[freed].entries) delete entry;
+            freed++;
+        }
+        retired.erase(retired.begin(), retired.begin() + freed);
+    }
+
+    static void freeTree(const PNode* node) {
+        if (node == nullptr) return;
+        freeTree(node->left);
+        freeTree(node->right);
+        delete node->entry;
+        delete node;
+    }
+
+public:
+    // A reader thread's handle: claims one epoch slot for its lifetime
+    // (waiting if all MAX_READERS slots are taken)
+    class Reader {
+    private:
+        ConcurrentDictionary* dict;
+        ReaderSlot* slot;
+
+    public:
+        explicit Reader(ConcurrentDictionary& d) : dict(&d), slot(nullptr) {
+            while (slot == nullptr) {
+                for (ReaderSlot& s : d.slots) {
+                    bool expected = false;
+                    if (s.claimed.compare_exchange_strong(expected, true)) {
+                        slot = &s;
+                        break;
+                    }
+                }
+            }
+        }
+        Reader(const Reader&) = delete;
+        Reader& operator=(const Reader&) = delete;
+        ~Reader() { slot->claimed.store(false, std::memory_order_release); }
+
+        // Copy the meaning of word into meaning; false if it is absent
+        bool find(std::string_view word, std::string& meaning) {
+            slot->epoch.store(dict->globalEpoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+            const PNode* node = dict->root.load(std::memory_order_seq_cst);
+            bool found = false;
+            while (node != nullptr) {
+                int cmp = word.compare(node->word);
+                if (cmp == 0) {
+                    meaning.assign(node->entry->meaning);
+                    found = true;
+                    break;
+                }
+                node = cmp < 0 ? node->left : node->right;
+            }
+            slot->epoch.store(0, std::memory_order_release);
+            return found;
+        }
+    };
+
+    ConcurrentDictionary() = default;
+    ConcurrentDictionary(const ConcurrentDictionary&) = delete;
+    ConcurrentDictionary& operator=(const ConcurrentDictionary&) = delete;
+
+    // Only call once no Reader is left
+    ~ConcurrentDictionary() {
+        freeTree(root.load());
+        for (const RetiredBatch& batch : retired) {
+            for (const PNode* node : batch.nodes) delete node;
+            for (const PEntry* entry : batch.entries) delete entry;
+        }
+    }
+
+    // Replace the contents with the entries of tree
+    void load(const BST& tree) {
+        std::lock_guard<std::mutex> guard(writeLock);
+        std::vector<const PEntry*> entries;
+        entries.reserve(tree.size());
+        tree.forEachNode([&](NodeId node) {
+            entries.push_back(new PEntry{std::string(tree.wordAt(node)), std::string(tree.meaningAt(node))});
+        });
+        const PNode* old = root.load();
+        // The old version is retired whole
+        std::vector<const PNode*> stack;
+        if (old != nullptr) stack.push_back(old);
+        while (!stack.empty()) {
+            const PNode* node = stack.back();
+            stack.pop_back();
+            pending.nodes.push_back(node);
+            pending.entries.push_back(node->entry);
+            if (node->left) stack.push_back(node->left);
+            if (node->right) stack.push_back(node->right);
+        }
+        count = entries.size();
+        publish(buildBalanced(entries, 0, entries.size()));
+    }
+
+    void insert(std::string_view word, std::string_view meaning) {
+        std::lock_guard<std::mutex> guard(writeLock);
+        const PEntry* entry = new PEntry{std::string(word), std::string(meaning)};
+        publish(insertAt(root.load(std::memory_order_relaxed), entry));
+    }
+
+    // Returns false if word was not present
+    bool remove(std::string_view word) {
+        std::lock_guard<std::mutex> guard(writeLock);
+        bool found = false;
+        const PNode* newRoot = removeAt(root.load(std::memory_order_relaxed), word, found);
+        if (!found) {
+            pending = RetiredBatch();
+            return false;
+        }
+        publish(newRoot);
+        return true;
+    }
+
+    std::size_t size() {
+        std::lock_guard<std::mutex> guard(writeLock);
+        return count;
+    }
+
+    // Batches retired but not yet freed (a reader is still in an older epoch)
+    std::size_t retiredBatches() {
+        std::lock_guard<std::mutex> guard(writeLock);
+        return retired.size();
+    }
+
+    // Validate the order and AVL heights of the current version (writers
+    // excluded). Returns the number of entries, or SIZE_MAX if invalid.
+    std::size_t check() {
+        std::lock_guard<std::mutex> guard(writeLock);
+        std::size_t n = 0;
+        bool ok = true;
+        std::vector<std::string_view> words;
+        struct Frame {
+            const PNode* node;
+            bool visited;
+        };
+        std::vector<Frame> stack;
+        if (root.load() != nullptr) stack.push_back({root.load(), false});
+        while (!stack.empty()) {
+            Frame f = stack.back();
+            stack.pop_back();
+            const PNode* node = f.node;
+            if (f.visited) {
+                words.push_back(node->word);
+                continue;
+            }
+            int lh = height(node->left), rh = height(node->right);
+            if (node->height != 1 + std::max(lh, rh) || std::abs(lh - rh) > 1) ok = false;
+            n++;
+            if (node->right) stack.push_back({node->right, false});
+            stack.push_back({node, true});
+            if (node->left) stack.push_back({node->left, false});
+        }
+        for (std::size_t i = 1; i < words.size(); i++) {
+            if (!(words[i - 1] < words[i])) ok = false;
+        }
+        return ok && n == count ? n : SIZE_MAX;
+    }
+};
+
+#endif // CONCURRENT_DICTIONARY_H
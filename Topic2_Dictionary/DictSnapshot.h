@@ -0,0 +1,351 @@
+#ifndef DICT_SNAPSHOT_H
+#define DICT_SNAPSHOT_H
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <optional>
+#include <filesystem>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include "Arena.h"
+#include "FileSync.h"
+#ifdef _WIN32
+#include <sstream>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// --- Binary dictionary snapshot ---
+//
+// Layout (host byte order, every section 8-byte aligned):
+//
+//   DictSnapshotHeader
+//   DictSnapshotEntry entries[n]     sorted by word; offsets into the pool
+//   char              pool[...]      all words and meanings, back to back
+//   DictSnapshotSlot  search[n + 1]  the entries in Eytzinger (BFS) order,
+//                                    1-based, each with an 8-byte key prefix
+//
+// The snapshot is written next to the text dictionary by compaction and
+// served in place through mmap: a read-only search, fuzzy or view_page maps the
+// file, checks the header and answers without parsing a line, building a
+// tree or allocating per entry. Exact search descends the Eytzinger array,
+// whose first levels share a few cache lines, comparing the key prefixes and
+// only reading the pool on a prefix tie; prefix search is a binary search
+// over the sorted entries followed by a scan, and a page of view_page is a
+// slice of the entry table.
+//
+// The header records the size and modification time of the text dictionary
+// it was built from, and a snapshot that does not match is ignored. So is
+// one whose sections, string offsets or search slots point outside the
+// mapping: open() checks them all (one sequential pass over the tables)
+// before anything is read through them.
+
+const char DICT_SNAPSHOT_MAGIC[8] = {'D', 'I', 'C', 'S', 'N', 'A', 'P', '1'};
+const uint32_t DICT_SNAPSHOT_VERSION = 1;
+
+struct DictSnapshotHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t reserved;
+    uint64_t entries;
+    uint64_t sourceSize;   // stamp of the text dictionary
+    int64_t sourceMtime;
+    uint64_t entriesOffset;
+    uint64_t poolOffset;
+    uint64_t searchOffset;
+    uint64_t fileSize;
+};
+
+struct DictSnapshotEntry {
+    uint32_t wordOffset;
+    uint32_t wordLength;
+    uint32_t meaningOffset;
+    uint32_t meaningLength;
+};
+
+struct DictSnapshotSlot {
+    uint64_t prefix; // first 8 bytes of the word, big-endian, zero-padded
+    uint32_t entry;
+    uint32_t reserved;
+};
+
+// Size and modification time of the text dictionary
+inline bool dictionaryStamp(const std::string& dataFile, uint64_t& size, int64_t& mtime) {
+    std::error_code ec;
+    size = std::filesystem::file_size(dataFile, ec);
+    if (ec) return false;
+    auto t = std::filesystem::last_write_time(dataFile, ec);
+    if (ec) return false;
+    mtime = static_cast<int64_t>(t.time_since_epoch().count());
+    return true;
+}
+
+inline std::string dictSnapshotPath(const std::string& dataFile) { return dataFile + ".snap"; }
+
+// Write tree (a BST or BTree: anything with size() and forEachEntry) as the
+// snapshot of dataFile, which must already hold the same entries. Written
+// to a temporary file, synced and renamed into place (see replaceFile).
+template <typename Tree>
+bool writeDictSnapshot(const Tree& tree, const std::string& dataFile) {
+    uint64_t sourceSize;
+    int64_t sourceMtime;
+    if (!dictionaryStamp(dataFile, sourceSize, sourceMtime)) return false;
+
+    std::vector<DictSnapshotEntry> table;
+    table.reserve(tree.size());
+    uint64_t poolBytes = 0;
+    tree.forEachEntry([&](std::string_view word, std::string_view meaning) {
+        DictSnapshotEntry e;
+        e.wordOffset = static_cast<uint32_t>(poolBytes);
+        e.wordLength = static_cast<uint32_t>(word.size());
+        e.meaningOffset = static_cast<uint32_t>(poolBytes + e.wordLength);
+        e.meaningLength = static_cast<uint32_t>(meaning.size());
+        poolBytes += e.wordLength + e.meaningLength;
+        table.push_back(e);
+    });
+    if (poolBytes > UINT32_MAX) {
+        std::cerr << "Snapshot pool exceeds 4 GiB" << std::endl;
+        return false;
+    }
+
+    // Eytzinger order: an in-order walk of the implicit tree k -> 2k, 2k + 1
+    uint64_t n = table.size();
+    std::vector<DictSnapshotSlot> search(n + 1, DictSnapshotSlot{0, 0, 0});
+    {
+        std::vector<std::string_view> words;
+        words.reserve(n);
+        tree.forEachEntry([&](std::string_view word, std::string_view) { words.push_back(word); });
+        uint32_t next = 0;
+        std::vector<uint64_t> stack;
+        for (uint64_t k = 1; k <= n || !stack.empty();) {
+            if (k <= n) {
+                stack.push_back(k);
+                k = 2 * k;
+            } else {
+                k = stack.back();
+                stack.pop_back();
+                search[k] = DictSnapshotSlot{keyPrefix(words[next]), next, 0};
+                next++;
+                k = 2 * k + 1;
+            }
+        }
+    }
+
+    auto align8 = [](uint64_t x) { return (x + 7) & ~uint64_t(7); };
+    DictSnapshotHeader h;
+    std::memset(&h, 0, sizeof(h));
+    std::memcpy(h.magic, DICT_SNAPSHOT_MAGIC, sizeof(h.magic));
+    h.version = DICT_SNAPSHOT_VERSION;
+    h.entries = n;
+    h.sourceSize = sourceSize;
+    h.sourceMtime = sourceMtime;
+    h.entriesOffset = align8(sizeof(DictSnapshotHeader));
+    h.poolOffset = align8(h.entriesOffset + n * sizeof(DictSnapshotEntry));
+    h.searchOffset = align8(h.poolOffset + poolBytes);
+    h.fileSize = h.searchOffset + (n + 1) * sizeof(DictSnapshotSlot);
+
+    std::string path = dictSnapshotPath(dataFile);
+    std::string tmp = path + ".tmp";
+    {
+        std::ofstream out(tmp, std::ios::binary);
+        if (!out) {
+            std::cerr << "Error opening file for writing: " << tmp << std::endl;
+            return false;
+        }
+        uint64_t written = 0;
+        auto padTo = [&](uint64_t offset) {
+            static const char zeros[8] = {0};
+            out.write(zeros, static_cast<std::streamsize>(offset - written));
+            written = offset;
+        };
+        auto put = [&](const void* p, uint64_t bytes) {
+            out.write(static_cast<const char*>(p), static_cast<std::streamsize>(bytes));
+            written += bytes;
+        };
+
+        put(&h, sizeof(h));
+        padTo(h.entriesOffset);
+        put(table.data(), n * sizeof(DictSnapshotEntry));
+        padTo(h.poolOffset);
+        tree.forEachEntry([&](std::string_view word, std::string_view meaning) {
+            put(word.data(), word.size());
+            put(meaning.data(), meaning.size());
+        });
+        padTo(h.searchOffset);
+        put(search.data(), search.size() * sizeof(DictSnapshotSlot));
+        out.close();
+        if (!out) return false;
+    }
+    return replaceFile(tmp, path);
+}
+
+// Read-only view of a mapped dictionary snapshot
+class DictSnapshot {
+private:
+    const char* base = nullptr;
+    std::size_t length = 0;
+#ifdef _WIN32
+    std::string buffer;
+#endif
+    uint64_t count = 0;
+    const DictSnapshotEntry* table = nullptr;
+    const char* pool = nullptr;
+    const DictSnapshotSlot* search = nullptr;
+
+    void unmap() {
+#ifndef _WIN32
+        if (base != nullptr && length > 0) munmap(const_cast<char*>(base), length);
+#endif
+        base = nullptr;
+        length = 0;
+    }
+
+    bool map(const std::string& path) {
+#ifdef _WIN32
+        std::ifstream in(path, std::ios::binary);
+        if (!in) return false;
+        std::ostringstream ss;
+        ss << in.rdbuf();
+        buffer = ss.str();
+        base = buffer.data();
+        length = buffer.size();
+        return true;
+#else
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size == 0) {
+            ::close(fd);
+            return false;
+        }
+        void* p = mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (p == MAP_FAILED) return false;
+        base = static_cast<const char*>(p);
+        length = static_cast<std::size_t>(st.st_size);
+        return true;
+#endif
+    }
+
+    // The sections must be aligned, in order and inside the mapping
+    // (sizes are compared by division so a huge count cannot overflow)
+    bool validLayout(const DictSnapshotHeader& h) const {
+        uint64_t n = h.entries;
+        if (h.entriesOffset % 8 != 0 || h.poolOffset % 8 != 0 || h.searchOffset % 8 != 0) return false;
+        if (h.entriesOffset < sizeof(DictSnapshotHeader) || h.entriesOffset > length) return false;
+        if (n > (length - h.entriesOffset) / sizeof(DictSnapshotEntry)) return false;
+        if (h.poolOffset < h.entriesOffset + n * sizeof(DictSnapshotEntry) || h.poolOffset > length) return false;
+        if (h.searchOffset < h.poolOffset || h.searchOffset > length) return false;
+        return n + 1 <= (length - h.searchOffset) / sizeof(DictSnapshotSlot);
+    }
+
+    // Every string must lie in the pool and every search slot name an entry
+    bool validEntries(uint64_t poolBytes) const {
+        for (uint64_t i = 0; i < count; i++) {
+            const DictSnapshotEntry& e = table[i];
+            if (uint64_t(e.wordOffset) + e.wordLength > poolBytes) return false;
+            if (uint64_t(e.meaningOffset) + e.meaningLength > poolBytes) return false;
+        }
+        for (uint64_t k = 1; k <= count; k++) {
+            if (search[k].entry >= count) return false;
+        }
+        return true;
+    }
+
+public:
+    DictSnapshot() = default;
+    DictSnapshot(const DictSnapshot&) = delete;
+    DictSnapshot& operator=(const DictSnapshot&) = delete;
+    ~DictSnapshot() { unmap(); }
+
+    // Map the snapshot of dataFile; false if it is missing, corrupt or
+    // older than the text dictionary
+    bool open(const std::string& dataFile) {
+        unmap();
+        uint64_t size;
+        int64_t mtime;
+        if (!dictionaryStamp(dataFile, size, mtime)) return false;
+        if (!map(dictSnapshotPath(dataFile))) return false;
+        if (length < sizeof(DictSnapshotHeader)) {
+            unmap();
+            return false;
+        }
+        const DictSnapshotHeader& h = *reinterpret_cast<const DictSnapshotHeader*>(base);
+        if (std::memcmp(h.magic, DICT_SNAPSHOT_MAGIC, sizeof(h.magic)) != 0 || h.version != DICT_SNAPSHOT_VERSION ||
+            h.fileSize != length || h.sourceSize != size || h.sourceMtime != mtime || !validLayout(h)) {
+            unmap();
+            return false;
+        }
+        count = h.entries;
+        table = reinterpret_cast<const DictSnapshotEntry*>(base + h.entriesOffset);
+        pool = base + h.poolOffset;
+        search = reinterpret_cast<const DictSnapshotSlot*>(base + h.searchOffset);
+        if (!validEntries(h.searchOffset - h.poolOffset)) {
+            unmap();
+            return false;
+        }
+        return true;
+    }
+
+    std::size_t size() const { return count; }
+
+    std::string_view wordAt(std::size_t i) const {
+        return std::string_view(pool + table[i].wordOffset, table[i].wordLength);
+    }
+    std::string_view meaningAt(std::size_t i) const {
+        return std::string_view(pool + table[i].meaningOffset, table[i].meaningLength);
+    }
+
+    // Exact lookup: Eytzinger descent on the key prefixes
+    std::optional<std::string_view> find(std::string_view word) const {
+        uint64_t prefix = keyPrefix(word);
+        for (uint64_t k = 1; k <= count;) {
+            const DictSnapshotSlot& s = search[k];
+            int cmp = prefix < s.prefix ? -1 : prefix > s.prefix ? 1 : word.compare(wordAt(s.entry));
+            if (cmp == 0) return meaningAt(s.entry);
+            k = 2 * k + (cmp > 0);
+        }
+        return std::nullopt;
+    }
+
+    // Visit entries [offset, offset + limit) in word order: direct indexing
+    template <typename Fn>
+    std::size_t forEachInPage(std::size_t offset, std::size_t limit, Fn fn) const {
+        if (offset >= count) return 0;
+        std::size_t end = count - offset < limit ? count : offset + limit;
+        for (std::size_t i = offset; i < end; i++) fn(wordAt(i), meaningAt(i));
+        return end - offset;
+    }
+
+    // Visit the words starting with prefix, skipping the first `offset`
+    // matches and stopping after `limit`. Returns the number visited.
+    template <typename Fn>
+    std::size_t forEachPrefix(std::string_view prefix, std::size_t offset, std::size_t limit, Fn fn) const {
+        std::size_t lo = 0, hi = count;
+        while (lo < hi) {
+            std::size_t mid = lo + (hi - lo) / 2;
+            if (wordAt(mid) < prefix) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        std::size_t visited = 0;
+        if (offset >= count - lo) return 0;
+        for (std::size_t i = lo + offset; i < count && visited < limit; i++, visited++) {
+            std::string_view w = wordAt(i);
+            if (w.substr(0, prefix.size()) != prefix) break;
+            fn(w, meaningAt(i));
+        }
+        return visited;
+    }
+};
+
+#endif // DICT_SNAPSHOT_H
@@ -0,0 +1,365 @@
+#ifndef DICTIONARY_H
+#define DICTIONARY_H
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <iomanip>
+#include <fstream>
+#include <optional>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <cstdint>
+#include "BST.h"
+#include "BTree.h"
+#include "RadixTrie.h"
+#include "HashIndex.h"
+#include "Journal.h"
+#include "DictSnapshot.h"
+
+using namespace std;
+
+// Print one page of prefix matches in the fuzzy command's format.
+// visit(print) must call print(word, meaning) for each match, in order.
+template <typename Visit>
+void printPrefixMatches(string_view prefix, Visit visit) {
+    cout << "Words starting with '" << prefix << "':" << endl;
+    cout << "----------------------------------------" << endl;
+    visit([](string_view w, string_view m) { cout << left << setw(20) << w << ": " << m << endl; });
+    cout << "----------------------------------------" << endl;
+}
+
+// Print entries [offset, offset + shown) of total in the view_all table format.
+// visit(print) must call print(word, meaning) for each entry of the page.
+template <typename Visit>
+void printPage(size_t total, size_t offset, Visit visit) {
+    if (total == 0) {
+        cout << "Dictionary is empty." << endl;
+        return;
+    }
+    size_t shown = 0;
+    cout << "----------------------------------------" << endl;
+    cout << left << setw(20) << "Word" << "Meaning" << endl;
+    cout << "----------------------------------------" << endl;
+    visit([&shown](string_view w, string_view m) {
+        cout << left << setw(20) << w << ": " << m << endl;
+        shown++;
+    });
+    cout << "----------------------------------------" << endl;
+    if (shown == 0) {
+        cout << "Entries: none of " << total << endl;
+    } else {
+        cout << "Entries: " << offset + 1 << "-" << offset + shown << " of " << total << endl;
+    }
+}
+
+// The files behind a dictionary opened from disk: the text snapshot, its
+// journal and its binary snapshot. Shared by both backends, whose tree
+// (a BST or a BTree) is passed in.
+class DictionaryFiles {
+private:
+    Journal journal;
+    string snapshotFile; // file the journal belongs to, empty if none
+
+public:
+    // Load filename into tree (if the file exists) plus its journal, then
+    // log further mutations to that journal
+    template <typename Tree>
+    void open(Tree& tree, const string& filename) {
+        ifstream f(filename);
+        if (f.good()) {
+            f.close();
+            tree.loadFromFile(filename);
+        }
+        string journalFile = Journal::pathFor(filename);
+        size_t records = Journal::replay(journalFile, [&](char op, string_view word, string_view meaning) {
+            if (op == Journal::INSERT) {
+                tree.insert(word, meaning);
+            } else if (tree.find(word)) {
+                tree.remove(word);
+            }
+        });
+        if (records > 0) cout << "Replayed " << records << " journal records from " << journalFile << endl;
+        snapshotFile = filename;
+        if (!journal.open(journalFile)) cout << "Error opening journal: " << journalFile << endl;
+    }
+
+    // Journal one mutation (a no-op if no file is open)
+    bool logInsert(string_view word, string_view meaning) {
+        if (!journal.isOpen() || journal.append(Journal::INSERT, word, meaning)) return true;
+        cout << "Error writing journal: " << journal.filePath() << endl;
+        return false;
+    }
+
+    bool logRemove(string_view word) {
+        if (!journal.isOpen() || journal.append(Journal::REMOVE, word, "")) return true;
+        cout << "Error writing journal: " << journal.filePath() << endl;
+        return false;
+    }
+
+    // Rewrite the text and binary snapshots with tree's contents and empty
+    // the journal. The journal is only truncated once the new text snapshot
+    // is synced and renamed into place, so a power loss cannot drop both.
+    template <typename Tree>
+    bool compact(const Tree& tree) {
+        if (snapshotFile.empty()) return false;
+        if (!tree.saveToFile(snapshotFile)) return false;
+        if (!writeDictSnapshot(tree, snapshotFile)) {
+            cout << "Error writing snapshot: " << dictSnapshotPath(snapshotFile) << endl;
+        }
+        return journal.reset();
+    }
+
+    // Saving over the opened snapshot is a compaction
+    template <typename Tree>
+    bool save(const Tree& tree, const string& filename) {
+        return filename == snapshotFile ? compact(tree) : tree.saveToFile(filename);
+    }
+};
+
+// Dictionary: the ordered tree plus the indexes built over it.
+//
+// The AVL tree owns the entries and stays the source of truth for ordered
+// output and saving; the radix trie maps words to tree node ids for
+// autocomplete and typo-tolerant search, and the hash index maps them for
+// O(1) exact lookups. Every mutation goes through this class so the indexes
+// never drift from the tree.
+//
+// A dictionary opened from a file also logs every mutation to the file's
+// journal (see Journal.h); compact() folds the journal into a new text
+// snapshot and rewrites the binary snapshot that read-only commands map.
+class Dictionary {
+private:
+    BST entries;
+    RadixTrie trie;
+    HashIndex hash;
+    DictionaryFiles files;
+
+    // Word of a tree node, for the hash index's key compares
+    auto keyOf() const {
+        return [this](NodeId node) { return entries.wordAt(node); };
+    }
+
+    // Helper: Rebuild every index from the tree (after a load)
+    void rebuildIndexes() {
+        trie.clear();
+        hash.clear();
+        hash.reserve(entries.size());
+        size_t bytes = 0;
+        entries.forEachNode([&](NodeId node) { bytes += entries.wordAt(node).size(); });
+        trie.reserve(entries.size(), bytes);
+        entries.forEachNode([&](NodeId node) {
+            trie.insert(entries.wordAt(node), node);
+            hash.insertUnique(entries.wordAt(node), node);
+        });
+    }
+
+public:
+    // Read-only access for display commands (print_tree, view_all, ...)
+    const BST& tree() const { return entries; }
+
+    size_t size() const { return entries.size(); }
+
+    // Exact lookup through the hash index: one hash and normally one compare
+    optional<string_view> find(string_view word) const {
+        NodeId node = hash.find(word, keyOf());
+        if (node == NIL) return nullopt;
+        return entries.meaningAt(node);
+    }
+
+    string search(string_view word) const {
+        optional<string_view> found = find(word);
+        return found ? string(*found) : "Word not found in the dictionary.";
+    }
+
+    // Mutations are journaled first; if the journal write fails nothing
+    // changes and false is returned
+    bool insert(string_view word, string_view meaning) {
+        if (!files.logInsert(word, meaning)) return false;
+        NodeId node = entries.insert(word, meaning);
+        trie.insert(word, node);
+        hash.insert(word, node, keyOf());
+        return true;
+    }
+
+    bool remove(string_view word) {
+        if (hash.find(word, keyOf()) != NIL && !files.logRemove(word)) return false;
+        trie.remove(word);
+        hash.remove(word, keyOf());
+        entries.remove(word);
+        return true;
+    }
+
+    void clear() {
+        entries.clear();
+        trie.clear();
+        hash.clear();
+    }
+
+    void loadFromFile(string filename) {
+        entries.loadFromFile(filename);
+        rebuildIndexes();
+    }
+
+    // Saving over the opened snapshot is a compaction
+    void saveToFile(string filename) { files.save(entries, filename); }
+
+    // Load filename (if it exists) plus its journal, then log further
+    // mutations to that journal
+    void open(const string& filename) {
+        files.open(entries, filename);
+        rebuildIndexes();
+    }
+
+    // Fold the journal into new text and binary snapshots
+    bool compact() { return files.compact(entries); }
+
+    // Extension: Fuzzy Search (prefix matches, optionally one page of them).
+    // A page within the first RadixTrie::TOP_K matches is served from the
+    // trie's cached completions; deeper pages fall back to a range scan.
+    void searchByPrefix(string_view prefix, size_t offset = 0, size_t limit = SIZE_MAX) const {
+        printPrefixMatches(prefix, [&](auto print) {
+            if (limit <= RadixTrie::TOP_K && offset <= RadixTrie::TOP_K - limit) {
+                NodeId top[RadixTrie::TOP_K];
+                size_t count = trie.completions(prefix, top, offset + limit);
+                for (size_t i = offset; i < count; i++) print(entries.wordAt(top[i]), entries.meaningAt(top[i]));
+            } else {
+                entries.forEachPrefix(prefix, offset, limit, print);
+            }
+        });
+    }
+
+    // Extension: Typo-tolerant search. Words within maxDist edits of word,
+    // closest first (ties in word order), found by walking the radix trie
+    // with a Damerau-Levenshtein DP row per byte instead of scanning every word.
+    void searchByEditDistance(string_view word, int maxDist, size_t limit = SIZE_MAX) const {
+        vector<pair<int, NodeId>> hits;
+        trie.forEachWithin(word, maxDist, [&](NodeId node, int dist) { hits.emplace_back(dist, node); });
+        // The walk is in word order, so a stable sort keeps ties alphabetical
+        stable_sort(hits.begin(), hits.end(),
+                    [](const pair<int, NodeId>& a, const pair<int, NodeId>& b) { return a.first < b.first; });
+        if (hits.size() > limit) hits.resize(limit);
+
+        cout << "Words within " << maxDist << " edit(s) of '" << word << "':" << endl;
+        cout << "----------------------------------------" << endl;
+        for (const pair<int, NodeId>& hit : hits) {
+            cout << left << setw(20) << entries.wordAt(hit.second) << ": " << entries.meaningAt(hit.second)
+                 << " (distance " << hit.first << ")" << endl;
+        }
+        cout << "----------------------------------------" << endl;
+    }
+
+    // One page of the sorted entries, found by rank: O(log n + limit)
+    void viewPage(size_t offset, size_t limit) const {
+        printPage(entries.size(), offset,
+                  [&](auto print) { entries.forEachInPage(offset, limit, print); });
+    }
+
+    void inOrder() const { entries.inOrder(); }
+    void printTree() const { entries.printTree(); }
+
+    // AVL invariants plus index consistency (used by check_tree)
+    bool checkTree() const {
+        bool ok = entries.checkBalance();
+        return checkIndexes() && ok;
+    }
+
+    // Check that every index agrees with the tree
+    bool checkIndexes() const {
+        bool trieOk = trie.size() == entries.size();
+        bool hashOk = hash.size() == entries.size();
+        entries.forEachNode([&](NodeId node) {
+            trieOk = trieOk && trie.find(entries.wordAt(node)) == node;
+            hashOk = hashOk && hash.find(entries.wordAt(node), keyOf()) == node;
+        });
+        cout << "Trie check " << (trieOk ? "OK" : "FAILED") << ": " << trie.size() << " words, "
+             << trie.nodeCount() << " nodes" << endl;
+        cout << "Hash check " << (hashOk ? "OK" : "FAILED") << ": " << hash.size() << " words" << endl;
+        return trieOk && hashOk;
+    }
+
+    // Heap footprint of the tree and of each index
+    void printMemory() const {
+        size_t n = entries.size();
+        auto row = [n](const char* name, size_t bytes) {
+            cout << left << setw(20) << name << right << setw(12) << bytes << " bytes";
+            if (n > 0) cout << "  (" << fixed << setprecision(1) << static_cast<double>(bytes) / n << " / entry)";
+            cout << endl;
+        };
+        cout << "Entries: " << n << endl;
+        row("AVL tree", entries.memoryBytes());
+        row("Radix trie", trie.memoryBytes());
+        row("Hash index", hash.memoryBytes());
+    }
+};
+
+// BTreeDictionary: the B+-tree backend (see BTree.h), selected at startup
+// with --backend btree.
+//
+// The B+-tree serves exact, prefix and paged lookups by itself, so there
+// are no side indexes to keep in sync; the files are handled by the same
+// DictionaryFiles as Dictionary's, so either backend can open what the
+// other wrote. Commands that need the AVL tree's subtree
+// sizes or the radix trie (rank, count_range, fuzzy_edit, tree_json) are
+// not offered.
+class BTreeDictionary {
+private:
+    BTree entries;
+    DictionaryFiles files;
+
+public:
+    const BTree& tree() const { return entries; }
+
+    size_t size() const { return entries.size(); }
+
+    optional<string_view> find(string_view word) const { return entries.find(word); }
+    string search(string_view word) const { return entries.search(word); }
+
+    bool insert(string_view word, string_view meaning) {
+        if (!files.logInsert(word, meaning)) return false;
+        entries.insert(word, meaning);
+        return true;
+    }
+
+    bool remove(string_view word) {
+        if (entries.find(word) && !files.logRemove(word)) return false;
+        entries.remove(word);
+        return true;
+    }
+
+    void clear() { entries.clear(); }
+
+    void loadFromFile(string filename) { entries.loadFromFile(filename); }
+
+    void saveToFile(string filename) { files.save(entries, filename); }
+    void open(const string& filename) { files.open(entries, filename); }
+    bool compact() { return files.compact(entries); }
+
+    void searchByPrefix(string_view prefix, size_t offset = 0, size_t limit = SIZE_MAX) const {
+        entries.searchByPrefix(prefix, offset, limit);
+    }
+
+    // One page of the sorted entries, found by rank: O(log n + limit)
+    void viewPage(size_t offset, size_t limit) const {
+        printPage(entries.size(), offset,
+                  [&](auto print) { entries.forEachInPage(offset, limit, print); });
+    }
+
+    void inOrder() const { entries.inOrder(); }
+    void printTree() const { entries.printTree(); }
+    bool checkTree() const { return entries.checkTree(); }
+
+    void printMemory() const {
+        size_t n = entries.size();
+        cout << "Entries: " << n << endl;
+        cout << left << setw(20) << "B+ tree" << right << setw(12) << entries.memoryBytes() << " bytes";
+        if (n > 0) {
+            cout << "  (" << fixed << setprecision(1) << static_cast<double>(entries.memoryBytes()) / n
+                 << " / entry)";
+        }
+        cout << endl;
+    }
+};
+
+#endif // DICTIONARY_H
@@ -0,0 +1,39 @@
+#ifndef FILE_SYNC_H
+#define FILE_SYNC_H
+
+#include <string>
+#include <filesystem>
+#include <system_error>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// Flush a file (or directory) to disk; true on platforms without fsync
+inline bool syncPath(const std::string& path) {
+#ifdef _WIN32
+    (void)path;
+    return true;
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    bool ok = fsync(fd) == 0;
+    ::close(fd);
+    return ok;
+#endif
+}
+
+// Move a fully written temporary file over target durably: the data is
+// synced before the rename and the directory after it, so after a power
+// loss target holds either the old or the new contents, and anything that
+// is dropped only once target is replaced (such as a journal) can rely on it.
+inline bool replaceFile(const std::string& tmp, const std::string& target) {
+    if (!syncPath(tmp)) return false;
+    std::error_code ec;
+    std::filesystem::rename(tmp, target, ec);
+    if (ec) return false;
+    std::filesystem::path dir = std::filesystem::path(target).parent_path();
+    return syncPath(dir.empty() ? std::string(".") : dir.string());
+}
+
+#endif // FILE_SYNC_H
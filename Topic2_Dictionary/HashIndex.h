@@ -0,0 +1,152 @@
+#ifndef HASH_INDEX_H
+#define HASH_INDEX_H
+
+#include <vector>
+#include <string_view>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include "Arena.h"
+
+// --- Open-addressing hash index for exact lookups ---
+//
+// Maps a word to the id of the dictionary node that holds it. Slots are
+// 8 bytes (the word's 32-bit hash and the node id) in one flat table probed
+// linearly with Robin Hood ordering: an insert takes the slot of any entry
+// that sits closer to its home slot, so probe lengths stay short and even,
+// and a lookup stops as soon as it meets an entry closer to home than the
+// key would be. Removal shifts the following run back by one instead of
+// leaving tombstones.
+//
+// The index does not store the words. Callers pass keyOf(node), which
+// returns the word of a node id; it is only called when the 32-bit hashes
+// match, so a lookup normally costs one string compare.
+class HashIndex {
+private:
+    struct Slot {
+        uint32_t hash;
+        NodeId node; // NIL for an empty slot
+    };
+
+    std::vector<Slot> slots;
+    std::size_t mask = 0;
+    std::size_t count = 0;
+
+    // FNV-1a, then a final avalanche so the low bits are usable as the slot
+    static uint32_t hashOf(std::string_view word) {
+        uint64_t h = 1469598103934665603ULL;
+        for (char c : word) {
+            h ^= static_cast<unsigned char>(c);
+            h *= 1099511628211ULL;
+        }
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return static_cast<uint32_t>(h);
+    }
+
+    // How far the entry in slot i sits from its home slot
+    std::size_t distance(std::size_t i) const { return (i - (slots[i].hash & mask)) & mask; }
+
+    // Robin Hood placement of a key known not to be in the table
+    void place(Slot s) {
+        std::size_t i = s.hash & mask;
+        std::size_t dist = 0;
+        while (slots[i].node != NIL) {
+            std::size_t existing = distance(i);
+            if (existing < dist) {
+                std::swap(s, slots[i]);
+                dist = existing;
+            }
+            i = (i + 1) & mask;
+            dist++;
+        }
+        slots[i] = s;
+    }
+
+    // Resize so that n entries stay under a 0.8 load factor
+    void grow(std::size_t n) {
+        std::size_t capacity = 16;
+        while (capacity * 4 < n * 5) capacity *= 2;
+        if (capacity <= slots.size()) return;
+        std::vector<Slot> old(capacity, Slot{0, NIL});
+        old.swap(slots);
+        mask = capacity - 1;
+        for (const Slot& s : old) {
+            if (s.node != NIL) place(s);
+        }
+    }
+
+    // Slot holding word, or SIZE_MAX
+    template <typename KeyOf>
+    std::size_t findSlot(std::string_view word, uint32_t h, KeyOf& keyOf) const {
+        if (count == 0) return SIZE_MAX;
+        std::size_t i = h & mask;
+        for (std::size_t dist = 0;; dist++) {
+            const Slot& s = slots[i];
+            if (s.node == NIL || distance(i) < dist) return SIZE_MAX;
+            if (s.hash == h && keyOf(s.node) == word) return i;
+            i = (i + 1) & mask;
+        }
+    }
+
+public:
+    std::size_t size() const { return count; }
+
+    void clear() {
+        slots.clear();
+        mask = 0;
+        count = 0;
+    }
+
+    void reserve(std::size_t n) { grow(n); }
+
+    // Heap bytes held by the slot table
+    std::size_t memoryBytes() const { return sizeof(*this) + slots.capacity() * sizeof(Slot); }
+
+    // Node id of word, or NIL
+    template <typename KeyOf>
+    NodeId find(std::string_view word, KeyOf keyOf) const {
+        std::size_t i = findSlot(word, hashOf(word), keyOf);
+        return i == SIZE_MAX ? NIL : slots[i].node;
+    }
+
+    // Map word to node (replacing the node of an existing word)
+    template <typename KeyOf>
+    void insert(std::string_view word, NodeId node, KeyOf keyOf) {
+        uint32_t h = hashOf(word);
+        std::size_t i = findSlot(word, h, keyOf);
+        if (i != SIZE_MAX) {
+            slots[i].node = node;
+            return;
+        }
+        grow(count + 1);
+        place(Slot{h, node});
+        count++;
+    }
+
+    // Map a word that is known not to be in the index (bulk rebuilds)
+    void insertUnique(std::string_view word, NodeId node) {
+        grow(count + 1);
+        place(Slot{hashOf(word), node});
+        count++;
+    }
+
+    // Drop word; does nothing if it is not in the index
+    template <typename KeyOf>
+    void remove(std::string_view word, KeyOf keyOf) {
+        std::size_t i = findSlot(word, hashOf(word), keyOf);
+        if (i == SIZE_MAX) return;
+        // Backward shift: pull the rest of the run one slot closer to home
+        std::size_t next = (i + 1) & mask;
+        while (slots[next].node != NIL && distance(next) > 0) {
+            slots[i] = slots[next];
+            i = next;
+            next = (next + 1) & mask;
+        }
+        slots[i] = Slot{0, NIL};
+        count--;
+    }
+};
+
+#endif // HASH_INDEX_H
@@ -0,0 +1,170 @@
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <fstream>
+#include <filesystem>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+// --- Append-only journal of dictionary mutations ---
+//
+// The text snapshot (dictionary.txt) is only rewritten by compaction; every
+// insert and remove in between is appended to "<snapshot>.journal" as one
+// record, in a single write, and synced to disk. Loading replays the journal
+// on top of the snapshot. Each record is
+//
+//   op (1 byte, 'I' or 'R') | word length (u32) | meaning length (u32)
+//   | word bytes | meaning bytes | CRC-32 of everything before it (u32)
+//
+// A record cut short by a crash, or one that fails its checksum, ends the
+// replay and is cut off the file, so the dictionary comes back as of the
+// last complete mutation. Replaying a record twice is harmless (the last
+// record for a word decides its state), so a crash between writing a new
+// snapshot and emptying the journal loses nothing either.
+class Journal {
+public:
+    static const char INSERT = 'I';
+    static const char REMOVE = 'R';
+
+private:
+    static const std::size_t HEADER = 1 + 2 * sizeof(uint32_t);
+
+    std::string path;
+    std::FILE* file = nullptr;
+
+    static uint32_t crc32(const char* data, std::size_t n) {
+        static uint32_t table[256];
+        static bool ready = false;
+        if (!ready) {
+            for (uint32_t i = 0; i < 256; i++) {
+                uint32_t c = i;
+                for (int k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+                table[i] = c;
+            }
+            ready = true;
+        }
+        uint32_t c = 0xFFFFFFFFu;
+        for (std::size_t i = 0; i < n; i++) c = table[(c ^ static_cast<unsigned char>(data[i])) & 0xFF] ^ (c >> 8);
+        return c ^ 0xFFFFFFFFu;
+    }
+
+public:
+    Journal() = default;
+    Journal(const Journal&) = delete;
+    Journal& operator=(const Journal&) = delete;
+    ~Journal() { close(); }
+
+    static std::string pathFor(const std::string& snapshot) { return snapshot + ".journal"; }
+
+    bool isOpen() const { return file != nullptr; }
+    const std::string& filePath() const { return path; }
+
+    // Call fn(op, word, meaning) for every intact record of the journal at
+    // path, in order, and cut off a torn or corrupt tail. Returns the number
+    // of records replayed (0 if there is no journal).
+    template <typename Fn>
+    static std::size_t replay(const std::string& path, Fn fn) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in) return 0;
+        std::error_code ec;
+        uint64_t fileSize = std::filesystem::file_size(path, ec);
+        if (ec) return 0;
+        std::vector<char> buffer;
+        std::size_t records = 0;
+        uint64_t valid = 0;
+        char header[HEADER];
+        while (in.read(header, HEADER)) {
+            uint32_t wordLength, meaningLength;
+            std::memcpy(&wordLength, header + 1, sizeof(wordLength));
+            std::memcpy(&meaningLength, header + 1 + sizeof(wordLength), sizeof(meaningLength));
+            if (header[0] != INSERT && header[0] != REMOVE) break;
+
+            // A torn or garbled length must not size the buffer: the record
+            // has to fit in what is left of the file
+            uint64_t body = static_cast<uint64_t>(wordLength) + meaningLength;
+            if (HEADER + body + sizeof(uint32_t) > fileSize - valid) break;
+            buffer.resize(HEADER + body + sizeof(uint32_t));
+            std::memcpy(buffer.data(), header, HEADER);
+            if (!in.read(buffer.data() + HEADER, static_cast<std::streamsize>(body + sizeof(uint32_t)))) break;
+            uint32_t stored;
+            std::memcpy(&stored, buffer.data() + HEADER + body, sizeof(stored));
+            if (stored != crc32(buffer.data(), HEADER + body)) break;
+
+            fn(header[0], std::string_view(buffer.data() + HEADER, wordLength),
+               std::string_view(buffer.data() + HEADER + wordLength, meaningLength));
+            records++;
+            valid += buffer.size();
+        }
+        in.close();
+
+        if (fileSize != valid) std::filesystem::resize_file(path, valid, ec);
+        return records;
+    }
+
+    // Open (creating if needed) the journal at path for appending
+    bool open(const std::string& journalPath) {
+        close();
+        path = journalPath;
+        file = std::fopen(path.c_str(), "ab");
+        if (file == nullptr) return false;
+        // Unbuffered: each record goes to the file in one write call
+        std::setvbuf(file, nullptr, _IONBF, 0);
+        return true;
+    }
+
+    void close() {
+        if (file != nullptr) std::fclose(file);
+        file = nullptr;
+    }
+
+    // Append one record and sync it to disk. A record that could not be
+    // written or synced in full is cut off again, so a later record never
+    // lands behind a torn one (replay would stop there and drop it); if even
+    // that fails, the journal is closed and refuses further appends.
+    bool append(char op, std::string_view word, std::string_view meaning) {
+        if (file == nullptr) return false;
+        uint32_t wordLength = static_cast<uint32_t>(word.size());
+        uint32_t meaningLength = static_cast<uint32_t>(meaning.size());
+        std::string record;
+        record.reserve(HEADER + word.size() + meaning.size() + sizeof(uint32_t));
+        record.push_back(op);
+        record.append(reinterpret_cast<const char*>(&wordLength), sizeof(wordLength));
+        record.append(reinterpret_cast<const char*>(&meaningLength), sizeof(meaningLength));
+        record.append(word);
+        record.append(meaning);
+        uint32_t crc = crc32(record.data(), record.size());
+        record.append(reinterpret_cast<const char*>(&crc), sizeof(crc));
+
+        if (std::fseek(file, 0, SEEK_END) != 0) return false;
+        long start = std::ftell(file);
+        if (start < 0) return false;
+        bool ok = std::fwrite(record.data(), 1, record.size(), file) == record.size();
+#ifndef _WIN32
+        ok = ok && fsync(fileno(file)) == 0;
+#endif
+        if (ok) return true;
+
+        std::clearerr(file);
+        std::error_code ec;
+        std::filesystem::resize_file(path, static_cast<std::uintmax_t>(start), ec);
+        if (ec) close();
+        return false;
+    }
+
+    // Drop every record (after the snapshot has absorbed them)
+    bool reset() {
+        if (file == nullptr) return false;
+        std::error_code ec;
+        std::filesystem::resize_file(path, 0, ec);
+        return !ec;
+    }
+};
+
+#endif // JOURNAL_H
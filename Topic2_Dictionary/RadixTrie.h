@@ -0,0 +1,360 @@
+#ifndef RADIX_TRIE_H
+#define RADIX_TRIE_H
+
+#include <vector>
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include "Arena.h"
+
+// --- Compressed radix trie for autocomplete ---
+//
+// Every edge carries a label of one or more bytes and no node has a single
+// child unless it also ends a word, so the trie has fewer than 2n nodes for n
+// words. Siblings are kept in byte order, which makes a subtree's words a
+// contiguous, ordered run of the dictionary.
+//
+// Each node caches the first TOP_K dictionary entries (in word order) of its
+// subtree: the node's own entry, then its children's caches in child order.
+// Answering "first k completions of prefix" is then a walk down |prefix|
+// bytes and a copy of one cache, whatever the size of the subtree.
+//
+// The trie stores entry ids (NodeIds of the dictionary tree), never the words'
+// meanings; the owner resolves ids and keeps the trie in sync on every insert,
+// remove and load.
+class RadixTrie {
+public:
+    static const int TOP_K = 10;
+
+private:
+    // 64 bytes with TOP_K = 10: one cache line per node
+    struct TrieNode {
+        StrRef label;        // bytes on the edge from the parent
+        NodeId firstChild;
+        NodeId nextSibling;  // siblings are sorted by the first label byte
+        NodeId entry;        // entry ending exactly here, or NIL
+        uint32_t topCount;
+        NodeId top[TOP_K];   // first TOP_K entries of the subtree, in order
+    };
+
+    NodePool<TrieNode> nodes;
+    StringArena labels;
+    NodeId root = NIL;
+    std::size_t entries = 0;
+
+    std::string_view label(NodeId node) const { return labels.get(nodes[node].label); }
+
+    static unsigned char firstByte(std::string_view s) { return static_cast<unsigned char>(s[0]); }
+
+    NodeId newNode(StrRef label, NodeId entry) {
+        TrieNode init;
+        init.label = label;
+        init.firstChild = NIL;
+        init.nextSibling = NIL;
+        init.entry = entry;
+        init.topCount = 0;
+        return nodes.alloc(init);
+    }
+
+    void ensureRoot() {
+        if (root == NIL) root = newNode(StrRef{0, 0}, NIL);
+    }
+
+    // Child of node whose label starts with byte c, or NIL
+    NodeId findChild(NodeId node, unsigned char c) const {
+        for (NodeId child = nodes[node].firstChild; child != NIL; child = nodes[child].nextSibling) {
+            unsigned char first = firstByte(label(child));
+            if (first == c) return child;
+            if (first > c) break;
+        }
+        return NIL;
+    }
+
+    // Link child under node, keeping the sibling list in byte order
+    void addChild(NodeId node, NodeId child) {
+        unsigned char c = firstByte(label(child));
+        NodeId prev = NIL;
+        NodeId cur = nodes[node].firstChild;
+        while (cur != NIL && firstByte(label(cur)) < c) {
+            prev = cur;
+            cur = nodes[cur].nextSibling;
+        }
+        nodes[child].nextSibling = cur;
+        if (prev == NIL) {
+            nodes[node].firstChild = child;
+        } else {
+            nodes[prev].nextSibling = child;
+        }
+    }
+
+    // Put replacement where child was in node's sibling list
+    void replaceChild(NodeId node, NodeId child, NodeId replacement) {
+        nodes[replacement].nextSibling = nodes[child].nextSibling;
+        if (nodes[node].firstChild == child) {
+            nodes[node].firstChild = replacement;
+            return;
+        }
+        NodeId prev = nodes[node].firstChild;
+        while (nodes[prev].nextSibling != child) prev = nodes[prev].nextSibling;
+        nodes[prev].nextSibling = replacement;
+    }
+
+    void unlinkChild(NodeId node, NodeId child) {
+        if (nodes[node].firstChild == child) {
+            nodes[node].firstChild = nodes[child].nextSibling;
+            return;
+        }
+        NodeId prev = nodes[node].firstChild;
+        while (nodes[prev].nextSibling != child) prev = nodes[prev].nextSibling;
+        nodes[prev].nextSibling = nodes[child].nextSibling;
+    }
+
+    // Recompute node's cache from its entry and its children's caches.
+    // Returns false if the cache did not change (so no ancestor's can have).
+    bool refreshTop(NodeId node) {
+        NodeId top[TOP_K];
+        uint32_t count = 0;
+        TrieNode& n = nodes[node];
+        if (n.entry != NIL) top[count++] = n.entry;
+        for (NodeId child = n.firstChild; child != NIL && count < TOP_K; child = nodes[child].nextSibling) {
+            const TrieNode& c = nodes[child];
+            for (uint32_t i = 0; i < c.topCount && count < TOP_K; i++) top[count++] = c.top[i];
+        }
+        if (count == n.topCount && std::equal(top, top + count, n.top)) return false;
+        n.topCount = count;
+        std::copy(top, top + count, n.top);
+        return true;
+    }
+
+    // Refresh the caches along path, deepest node first
+    void refreshPath(const std::vector<NodeId>& path) {
+        for (std::size_t i = path.size(); i > 0; i--) {
+            if (!refreshTop(path[i - 1])) return;
+        }
+    }
+
+    // Fold a non-root node with no entry and exactly one child into that child
+    void mergeWithChild(NodeId parent, NodeId node) {
+        NodeId child = nodes[node].firstChild;
+        std::string joined;
+        joined.reserve(nodes[node].label.length + nodes[child].label.length);
+        joined.append(label(node));
+        joined.append(label(child));
+        labels.release(nodes[node].label);
+        labels.release(nodes[child].label);
+        nodes[child].label = labels.add(joined);
+        replaceChild(parent, node, child);
+        nodes.release(node);
+    }
+
+    // Helper: Rewrite the label arena once more than half of it is garbage
+    void compactLabels() {
+        if (labels.garbageBytes() < 4096 || labels.garbageBytes() * 2 < labels.size()) return;
+        StringArena fresh;
+        fresh.reserve(labels.size() - labels.garbageBytes());
+        std::vector<NodeId> stack{root};
+        while (!stack.empty()) {
+            NodeId node = stack.back();
+            stack.pop_back();
+            nodes[node].label = fresh.add(label(node));
+            for (NodeId child = nodes[node].firstChild; child != NIL; child = nodes[child].nextSibling) {
+                stack.push_back(child);
+            }
+        }
+        labels.swap(fresh);
+    }
+
+    // Helper: Edit-distance walk below node. rows holds one DP row of
+    // query.size() + 1 cells per candidate byte so far and chars the bytes.
+    template <typename Fn>
+    void within(NodeId node, std::size_t depth, std::string_view query, int maxDist, std::vector<int>& rows,
+                std::string& chars, Fn& fn) const {
+        const std::size_t width = query.size() + 1;
+        for (char c : label(node)) {
+            depth++;
+            if (rows.size() < (depth + 1) * width) rows.resize((depth + 1) * width);
+            if (chars.size() < depth) chars.resize(depth);
+            chars[depth - 1] = c;
+            const int* prev = &rows[(depth - 1) * width];
+            const int* prev2 = depth >= 2 ? &rows[(depth - 2) * width] : nullptr;
+            int* cur = &rows[depth * width];
+            cur[0] = static_cast<int>(depth);
+            int rowMin = cur[0];
+            for (std::size_t j = 1; j < width; j++) {
+                int cost = query[j - 1] == c ? 0 : 1;
+                int d = std::min({prev[j] + 1, cur[j - 1] + 1, prev[j - 1] + cost});
+                // Transposition of two adjacent bytes
+                if (prev2 && j >= 2 && query[j - 1] == chars[depth - 2] && query[j - 2] == c) {
+                    d = std::min(d, prev2[j - 2] + 1);
+                }
+                cur[j] = d;
+                rowMin = std::min(rowMin, d);
+            }
+            // Row minima never decrease, so no longer candidate can come back in range
+            if (rowMin > maxDist) return;
+        }
+        int dist = rows[depth * width + query.size()];
+        if (nodes[node].entry != NIL && dist <= maxDist) fn(nodes[node].entry, dist);
+        for (NodeId child = nodes[node].firstChild; child != NIL; child = nodes[child].nextSibling) {
+            within(child, depth, query, maxDist, rows, chars, fn);
+        }
+    }
+
+public:
+    void clear() {
+        nodes.clear();
+        labels.clear();
+        root = NIL;
+        entries = 0;
+    }
+
+    void reserve(std::size_t words, std::size_t labelBytes) {
+        nodes.reserve(2 * words + 1);
+        labels.reserve(labelBytes);
+    }
+
+    std::size_t size() const { return entries; }
+    std::size_t nodeCount() const { return nodes.size(); }
+
+    // Heap bytes held by the node pool and label arena
+    std::size_t memoryBytes() const { return sizeof(*this) + nodes.capacityBytes() + labels.capacityBytes(); }
+
+    // Map word to entry id (replacing any previous id for the same word)
+    void insert(std::string_view word, NodeId id) {
+        ensureRoot();
+        std::vector<NodeId> path{root};
+        NodeId node = root;
+        std::size_t pos = 0;
+        while (pos < word.size()) {
+            NodeId child = findChild(node, static_cast<unsigned char>(word[pos]));
+            if (child == NIL) {
+                // New leaf carrying the rest of the word
+                NodeId leaf = newNode(labels.add(word.substr(pos)), id);
+                addChild(node, leaf);
+                path.push_back(leaf);
+                entries++;
+                refreshPath(path);
+                compactLabels();
+                return;
+            }
+            std::string_view edge = label(child);
+            std::size_t common = 0;
+            std::size_t most = std::min(edge.size(), word.size() - pos);
+            while (common < most && edge[common] == word[pos + common]) common++;
+            if (common < edge.size()) {
+                // Split the edge: a new node takes the shared part of the label
+                StrRef full = nodes[child].label;
+                NodeId mid = newNode(StrRef{full.offset, static_cast<uint32_t>(common)}, NIL);
+                nodes[child].label = StrRef{full.offset + static_cast<uint32_t>(common),
+                                            full.length - static_cast<uint32_t>(common)};
+                replaceChild(node, child, mid);
+                nodes[child].nextSibling = NIL;
+                nodes[mid].firstChild = child;
+                nodes[mid].topCount = nodes[child].topCount;
+                std::copy(nodes[child].top, nodes[child].top + nodes[child].topCount, nodes[mid].top);
+                child = mid;
+            }
+            node = child;
+            path.push_back(node);
+            pos += common;
+        }
+        if (nodes[node].entry == NIL) entries++;
+        nodes[node].entry = id;
+        refreshPath(path);
+    }
+
+    // Drop word; does nothing if it is not in the trie
+    void remove(std::string_view word) {
+        if (root == NIL) return;
+        std::vector<NodeId> path{root};
+        NodeId node = root;
+        std::size_t pos = 0;
+        while (pos < word.size()) {
+            NodeId child = findChild(node, static_cast<unsigned char>(word[pos]));
+            if (child == NIL) return;
+            std::string_view edge = label(child);
+            if (word.substr(pos, edge.size()) != edge) return;
+            node = child;
+            path.push_back(node);
+            pos += edge.size();
+        }
+        if (nodes[node].entry == NIL) return;
+        nodes[node].entry = NIL;
+        entries--;
+
+        // Restore the compression invariant around the emptied node
+        if (node != root) {
+            NodeId parent = path[path.size() - 2];
+            NodeId first = nodes[node].firstChild;
+            if (first == NIL) {
+                unlinkChild(parent, node);
+                labels.release(nodes[node].label);
+                nodes.release(node);
+                path.pop_back();
+                if (parent != root && nodes[parent].entry == NIL &&
+                    nodes[nodes[parent].firstChild].nextSibling == NIL) {
+                    mergeWithChild(path[path.size() - 2], parent);
+                    path.pop_back();
+                }
+            } else if (nodes[first].nextSibling == NIL) {
+                mergeWithChild(parent, node);
+                path.pop_back();
+            }
+        }
+        refreshPath(path);
+        compactLabels();
+    }
+
+    // Entry id of word, or NIL
+    NodeId find(std::string_view word) const {
+        NodeId node = root;
+        std::size_t pos = 0;
+        while (node != NIL && pos < word.size()) {
+            node = findChild(node, static_cast<unsigned char>(word[pos]));
+            if (node == NIL) return NIL;
+            std::string_view edge = label(node);
+            if (word.substr(pos, edge.size()) != edge) return NIL;
+            pos += edge.size();
+        }
+        return node == NIL ? NIL : nodes[node].entry;
+    }
+
+    // Copy the first min(TOP_K, k) entry ids of the words starting with
+    // prefix into out, in word order: O(|prefix|), no subtree walk.
+    // Returns the number copied.
+    std::size_t completions(std::string_view prefix, NodeId* out, std::size_t k) const {
+        NodeId node = root;
+        std::size_t pos = 0;
+        while (node != NIL && pos < prefix.size()) {
+            node = findChild(node, static_cast<unsigned char>(prefix[pos]));
+            if (node == NIL) return 0;
+            std::string_view edge = label(node);
+            std::size_t n = std::min(edge.size(), prefix.size() - pos);
+            // The prefix may end inside this edge; the subtree still matches
+            if (prefix.compare(pos, n, edge.substr(0, n)) != 0) return 0;
+            pos += n;
+        }
+        if (node == NIL) return 0;
+        std::size_t count = std::min<std::size_t>(k, nodes[node].topCount);
+        std::copy(nodes[node].top, nodes[node].top + count, out);
+        return count;
+    }
+
+    // Visit fn(entry, distance) for every word within maxDist edits of query,
+    // in word order. Distance is optimal-string-alignment Damerau-Levenshtein
+    // (insert, delete, substitute, or swap two adjacent bytes). The DP row
+    // for a shared prefix is computed once per trie byte, and a subtree is
+    // skipped as soon as no cell of its row is within maxDist.
+    template <typename Fn>
+    void forEachWithin(std::string_view query, int maxDist, Fn fn) const {
+        if (root == NIL) return;
+        std::vector<int> rows(query.size() + 1);
+        for (std::size_t j = 0; j <= query.size(); j++) rows[j] = static_cast<int>(j);
+        std::string chars;
+        within(root, 0, query, maxDist, rows, chars, fn);
+    }
+};
+
+#endif // RADIX_TRIE_H
@@ -0,0 +1,140 @@
+// Backend benchmark: AVL tree versus B+-tree.
+//
+// Usage: bench_dictionary_btree [max_entries]
+//
+// For 1K, 10K, ... up to max_entries (default 1,000,000) random words, and
+// for two load orders (random, and sorted as in a saved dictionary), inserts
+// every word one at a time into a BST and into a BTree, then times 1M
+// lookups of present words (hits) and of absent words (misses) in random
+// order and one full in-order scan. Memory is the heap held by each tree.
+//
+// A churn phase follows: every other word is removed and put back, then the
+// tree is drained one word at a time (timed as ns_per_remove), with the
+// structure checked after each step. For the B+-tree this exercises borrow,
+// merge and root collapse; any failure exits non-zero.
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include "BST.h"
+#include "BTree.h"
+
+using namespace std;
+
+const size_t LOOKUPS = 1000000;
+
+string randomWord(mt19937_64& rng) {
+    uniform_int_distribution<int> wordLen(4, 12), letter(0, 25);
+    string w;
+    for (int k = wordLen(rng); k > 0; k--) w += static_cast<char>('a' + letter(rng));
+    return w;
+}
+
+double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+// Structure check with its report kept off the CSV
+bool checkStructure(const BST& tree) {
+    streambuf* saved = cout.rdbuf(nullptr);
+    bool ok = tree.checkBalance();
+    cout.rdbuf(saved);
+    return ok;
+}
+
+bool checkStructure(const BTree& tree) {
+    streambuf* saved = cout.rdbuf(nullptr);
+    bool ok = tree.checkTree();
+    cout.rdbuf(saved);
+    return ok;
+}
+
+// Remove every other entry and reinsert it, then remove them all; returns
+// the seconds spent draining, or a negative value if a check fails
+template <typename Tree>
+double churn(Tree& tree, const vector<Entry>& entries) {
+    for (size_t i = 0; i < entries.size(); i += 2) tree.remove(entries[i].first);
+    if (!checkStructure(tree) || tree.size() != entries.size() / 2) return -1;
+    for (size_t i = 0; i < entries.size(); i += 2) tree.insert(entries[i].first, entries[i].second);
+    if (!checkStructure(tree) || tree.size() != entries.size()) return -1;
+
+    auto start = chrono::steady_clock::now();
+    for (const Entry& e : entries) tree.remove(e.first);
+    double seconds = secondsSince(start);
+    if (!checkStructure(tree) || tree.size() != 0) return -1;
+    return seconds;
+}
+
+// Insert every entry, time the lookups and a scan, and print one CSV row
+template <typename Tree>
+bool run(const char* structure, const char* order, const vector<Entry>& entries, const vector<string>& hits,
+         const vector<string>& misses) {
+    Tree tree;
+    auto start = chrono::steady_clock::now();
+    for (const Entry& e : entries) tree.insert(e.first, e.second);
+    double insertSeconds = secondsSince(start);
+
+    size_t found = 0;
+    start = chrono::steady_clock::now();
+    for (const string& w : hits) found += tree.find(w).has_value();
+    double hitSeconds = secondsSince(start);
+    start = chrono::steady_clock::now();
+    for (const string& w : misses) found += tree.find(w).has_value();
+    double missSeconds = secondsSince(start);
+
+    size_t scanned = 0;
+    start = chrono::steady_clock::now();
+    tree.forEachEntry([&](string_view w, string_view) { scanned += w.size(); });
+    double scanSeconds = secondsSince(start);
+
+    size_t n = tree.size();
+    double bytesPerEntry = static_cast<double>(tree.memoryBytes()) / n;
+    if (found != LOOKUPS || scanned == 0) {
+        fprintf(stderr, "%s: %zu of %zu hits found\n", structure, found, LOOKUPS);
+        return false;
+    }
+    double removeSeconds = churn(tree, entries);
+    if (removeSeconds < 0) {
+        fprintf(stderr, "%s: structure check failed during churn (%s, %zu entries)\n", structure, order, n);
+        return false;
+    }
+
+    printf("%s,%s,%zu,%.1f,%.1f,%.1f,%.2f,%.1f,%.1f\n", structure, order, n, insertSeconds * 1e9 / entries.size(),
+           hitSeconds * 1e9 / LOOKUPS, missSeconds * 1e9 / LOOKUPS, scanSeconds * 1e3, removeSeconds * 1e9 / n,
+           bytesPerEntry);
+    fflush(stdout);
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    size_t maxEntries = argc > 1 ? strtoull(argv[1], nullptr, 10) : 1000000;
+    mt19937_64 rng(20240601);
+
+    printf("structure,order,entries,ns_per_insert,ns_per_hit,ns_per_miss,scan_ms,ns_per_remove,bytes_per_entry\n");
+    for (size_t n = 1000; n <= maxEntries; n *= 10) {
+        // Unique random words (digits never occur in words, so misses end in one)
+        vector<Entry> entries(n);
+        for (size_t i = 0; i < n; i++) entries[i] = Entry(randomWord(rng), "meaning");
+        sortUniqueEntries(entries);
+        vector<string> hits(LOOKUPS), misses(LOOKUPS);
+        uniform_int_distribution<size_t> pick(0, entries.size() - 1);
+        for (size_t i = 0; i < LOOKUPS; i++) {
+            hits[i] = entries[pick(rng)].first;
+            misses[i] = randomWord(rng) + "0";
+        }
+
+        vector<Entry> shuffled = entries;
+        shuffle(shuffled.begin(), shuffled.end(), rng);
+        bool ok = run<BST>("avl_tree", "random", shuffled, hits, misses) &&
+                  run<BTree>("b_plus_tree", "random", shuffled, hits, misses) &&
+                  run<BST>("avl_tree", "sorted", entries, hits, misses) &&
+                  run<BTree>("b_plus_tree", "sorted", entries, hits, misses);
+        if (!ok) return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,186 @@
+// Concurrent read benchmark and stress test for ConcurrentDictionary.
+//
+// Usage: bench_dictionary_concurrent [entries] [max_readers] [millis]
+//
+// For 1, 2, 4, ... up to max_readers (default: hardware threads) reader
+// threads, runs random lookups for `millis` ms (default 300) while one writer
+// keeps inserting and removing words, against two structures:
+//
+//   mutex_bst      BST behind one std::mutex (readers and writer take it)
+//   cow_avl        ConcurrentDictionary: lock-free readers, copy-on-write
+//
+// Half of the words are never touched by the writer, and readers must always
+// find them with their own meaning; the others may be present or not, but a
+// hit must carry the right meaning. Any violation, or a tree that fails its
+// invariant check afterwards, is reported on stderr and the program exits 1.
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <random>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <cstdio>
+#include <cstdlib>
+#include "BST.h"
+#include "ConcurrentDictionary.h"
+
+using namespace std;
+
+// Baseline: the plain tree behind one mutex
+class MutexDictionary {
+private:
+    BST tree;
+    mutex lock;
+
+public:
+    void load(const vector<Entry>& entries) {
+        lock_guard<mutex> guard(lock);
+        tree.bulkLoad(entries);
+    }
+    bool find(string_view word, string& meaning) {
+        lock_guard<mutex> guard(lock);
+        optional<string_view> found = tree.find(word);
+        if (found) meaning.assign(*found);
+        return found.has_value();
+    }
+    void insert(string_view word, string_view meaning) {
+        lock_guard<mutex> guard(lock);
+        tree.insert(word, meaning);
+    }
+    void remove(string_view word) {
+        lock_guard<mutex> guard(lock);
+        if (tree.find(word)) tree.remove(word);
+    }
+};
+
+string meaningOf(const string& word) { return "meaning of " + word; }
+
+struct RunResult {
+    double readsPerSecond;
+    size_t writes;
+    size_t errors;
+};
+
+// readerFind(threadIndex) returns the lookup function for one reader thread
+template <typename MakeFind, typename Insert, typename Remove>
+RunResult run(int readers, int millis, const vector<string>& stable, const vector<string>& churn,
+              MakeFind makeFind, Insert insert, Remove remove) {
+    atomic<bool> stop{false};
+    atomic<size_t> reads{0}, errors{0};
+    size_t writes = 0;
+
+    vector<thread> threads;
+    for (int t = 0; t < readers; t++) {
+        threads.emplace_back([&, t]() {
+            auto find = makeFind();
+            mt19937_64 rng(1000 + t);
+            uniform_int_distribution<size_t> pickStable(0, stable.size() - 1), pickChurn(0, churn.size() - 1);
+            string meaning;
+            size_t n = 0, bad = 0;
+            while (!stop.load(memory_order_relaxed)) {
+                for (int k = 0; k < 64; k++, n++) {
+                    if (n & 1) {
+                        const string& w = stable[pickStable(rng)];
+                        if (!find(w, meaning) || meaning != meaningOf(w)) bad++;
+                    } else {
+                        const string& w = churn[pickChurn(rng)];
+                        if (find(w, meaning) && meaning != meaningOf(w)) bad++;
+                    }
+                }
+            }
+            reads += n;
+            errors += bad;
+        });
+    }
+
+    // Writer: toggle the churn words one at a time, with a short pause between edits
+    thread writer([&]() {
+        vector<bool> present(churn.size(), true);
+        mt19937_64 rng(7);
+        uniform_int_distribution<size_t> pick(0, churn.size() - 1);
+        while (!stop.load(memory_order_relaxed)) {
+            size_t i = pick(rng);
+            if (present[i]) {
+                remove(churn[i]);
+            } else {
+                insert(churn[i], meaningOf(churn[i]));
+            }
+            present[i] = !present[i];
+            writes++;
+            this_thread::sleep_for(chrono::microseconds(20));
+        }
+        // Put everything back so the next run starts from the full set
+        for (size_t i = 0; i < churn.size(); i++) {
+            if (!present[i]) insert(churn[i], meaningOf(churn[i]));
+        }
+    });
+
+    auto start = chrono::steady_clock::now();
+    this_thread::sleep_for(chrono::milliseconds(millis));
+    stop = true;
+    for (thread& t : threads) t.join();
+    writer.join();
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    return RunResult{reads.load() / seconds, writes, errors.load()};
+}
+
+int main(int argc, char* argv[]) {
+    size_t entries = argc > 1 ? strtoull(argv[1], nullptr, 10) : 100000;
+    int maxReaders = argc > 2 ? atoi(argv[2]) : static_cast<int>(thread::hardware_concurrency());
+    int millis = argc > 3 ? atoi(argv[3]) : 300;
+    if (entries < 2) entries = 2;
+    if (maxReaders < 1) maxReaders = 1;
+    if (maxReaders > ConcurrentDictionary::MAX_READERS) maxReaders = ConcurrentDictionary::MAX_READERS;
+
+    vector<string> stable, churn;
+    vector<Entry> all;
+    for (size_t i = 0; i < entries; i++) {
+        string w = (i % 2 ? "s" : "c") + to_string(i * 2654435761u % 1000000007u);
+        (i % 2 ? stable : churn).push_back(w);
+        all.emplace_back(w, meaningOf(w));
+    }
+    BST tree;
+    tree.bulkLoad(all);
+
+    MutexDictionary locked;
+    locked.load(all);
+    ConcurrentDictionary cow;
+    cow.load(tree);
+
+    size_t failures = 0;
+    printf("structure,readers,reads_per_second,writes,errors\n");
+    for (int readers = 1; readers <= maxReaders; readers *= 2) {
+        RunResult r = run(
+            readers, millis, stable, churn,
+            [&]() { return [&](string_view w, string& m) { return locked.find(w, m); }; },
+            [&](const string& w, const string& m) { locked.insert(w, m); },
+            [&](const string& w) { locked.remove(w); });
+        printf("mutex_bst,%d,%.0f,%zu,%zu\n", readers, r.readsPerSecond, r.writes, r.errors);
+        failures += r.errors;
+
+        r = run(
+            readers, millis, stable, churn,
+            [&]() {
+                auto reader = make_shared<ConcurrentDictionary::Reader>(cow);
+                return [reader](string_view w, string& m) { return reader->find(w, m); };
+            },
+            [&](const string& w, const string& m) { cow.insert(w, m); },
+            [&](const string& w) { cow.remove(w); });
+        printf("cow_avl,%d,%.0f,%zu,%zu\n", readers, r.readsPerSecond, r.writes, r.errors);
+        fflush(stdout);
+        failures += r.errors;
+
+        if (cow.check() != tree.size()) {
+            fprintf(stderr, "cow_avl: tree invariant or size check failed after %d readers\n", readers);
+            failures++;
+        }
+    }
+    if (failures > 0) {
+        fprintf(stderr, "%zu consistency failure(s)\n", failures);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,86 @@
+// Exact-lookup benchmark: AVL tree descent versus the hash index.
+//
+// Usage: bench_dictionary_lookup [max_entries]
+//
+// Builds dictionaries of 1K, 10K, ... up to max_entries (default 1,000,000)
+// random words and times 1M lookups of present words (hits) and of absent
+// words (misses) in random order, through BST::find and through the
+// HashIndex that Dictionary uses for search.
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <random>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include "BST.h"
+#include "HashIndex.h"
+
+using namespace std;
+
+const size_t LOOKUPS = 1000000;
+
+string randomWord(mt19937_64& rng) {
+    uniform_int_distribution<int> wordLen(4, 12), letter(0, 25);
+    string w;
+    for (int k = wordLen(rng); k > 0; k--) w += static_cast<char>('a' + letter(rng));
+    return w;
+}
+
+double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+void report(const char* structure, size_t n, double hitSeconds, double missSeconds) {
+    printf("%s,%zu,%zu,%.1f,%.1f\n", structure, n, LOOKUPS, hitSeconds * 1e9 / LOOKUPS,
+           missSeconds * 1e9 / LOOKUPS);
+    fflush(stdout);
+}
+
+int main(int argc, char* argv[]) {
+    size_t maxEntries = argc > 1 ? strtoull(argv[1], nullptr, 10) : 1000000;
+    mt19937_64 rng(20240601);
+
+    printf("structure,entries,lookups,ns_per_hit,ns_per_miss\n");
+    for (size_t n = 1000; n <= maxEntries; n *= 10) {
+        vector<Entry> entries(n);
+        for (size_t i = 0; i < n; i++) entries[i] = Entry(randomWord(rng), "meaning");
+
+        BST tree;
+        tree.bulkLoad(entries);
+        HashIndex hash;
+        hash.reserve(tree.size());
+        tree.forEachNode([&](NodeId node) { hash.insertUnique(tree.wordAt(node), node); });
+        auto keyOf = [&](NodeId node) { return tree.wordAt(node); };
+
+        // Query words: present ones in random order, and absent ones (digits never occur in words)
+        vector<string> hits(LOOKUPS), misses(LOOKUPS);
+        uniform_int_distribution<size_t> pick(0, n - 1);
+        for (size_t i = 0; i < LOOKUPS; i++) {
+            hits[i] = entries[pick(rng)].first;
+            misses[i] = randomWord(rng) + "0";
+        }
+
+        size_t found = 0;
+        auto start = chrono::steady_clock::now();
+        for (const string& w : hits) found += tree.find(w).has_value();
+        double hitSeconds = secondsSince(start);
+        start = chrono::steady_clock::now();
+        for (const string& w : misses) found += tree.find(w).has_value();
+        report("avl_tree", n, hitSeconds, secondsSince(start));
+
+        start = chrono::steady_clock::now();
+        for (const string& w : hits) found += hash.find(w, keyOf) != NIL;
+        hitSeconds = secondsSince(start);
+        start = chrono::steady_clock::now();
+        for (const string& w : misses) found += hash.find(w, keyOf) != NIL;
+        report("hash_index", n, hitSeconds, secondsSince(start));
+
+        if (found != 2 * LOOKUPS) {
+            fprintf(stderr, "lookup mismatch: %zu of %zu hits found\n", found, 2 * LOOKUPS);
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,149 @@
+// Memory benchmark for the dictionary tree layout.
+//
+// Usage: bench_dictionary_memory [max_entries]
+//
+// Builds dictionaries of 1K, 10K, ... up to max_entries (default 1,000,000)
+// words twice: once with the previous layout (one heap node per entry holding
+// two std::string and two pointers) and once with BST's arena layout. Global
+// operator new is instrumented, so heap_bytes is the exact number of bytes the
+// tree requested; allocations is the number of live heap blocks, each of which
+// also costs the allocator's own header (typically 8-16 bytes) on top.
+// The radix_trie rows measure the autocomplete index built over the arena
+// tree (see RadixTrie.h); it is held in addition to the tree.
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <random>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include "BST.h"
+#include "RadixTrie.h"
+
+using namespace std;
+
+// --- Heap instrumentation ---
+
+static size_t g_liveBytes = 0;
+static size_t g_liveBlocks = 0;
+
+// Each block carries its size in a 16-byte header so delete can account for it
+void* operator new(size_t size) {
+    void* p = malloc(size + 16);
+    if (!p) throw bad_alloc();
+    *static_cast<size_t*>(p) = size;
+    g_liveBytes += size;
+    g_liveBlocks++;
+    return static_cast<char*>(p) + 16;
+}
+
+void operator delete(void* p) noexcept {
+    if (!p) return;
+    char* block = static_cast<char*>(p) - 16;
+    g_liveBytes -= *reinterpret_cast<size_t*>(block);
+    g_liveBlocks--;
+    free(block);
+}
+
+void operator delete(void* p, size_t) noexcept { operator delete(p); }
+
+// --- Previous layout: one heap node per entry ---
+
+struct PointerNode {
+    string word;
+    string meaning;
+    PointerNode* left;
+    PointerNode* right;
+    int height;
+};
+
+PointerNode* buildPointerTree(const vector<Entry>& entries, size_t lo, size_t hi) {
+    if (lo >= hi) return nullptr;
+    size_t mid = lo + (hi - lo) / 2;
+    PointerNode* node = new PointerNode{entries[mid].first, entries[mid].second, nullptr, nullptr, 1};
+    node->left = buildPointerTree(entries, lo, mid);
+    node->right = buildPointerTree(entries, mid + 1, hi);
+    return node;
+}
+
+void freePointerTree(PointerNode* node) {
+    if (node == nullptr) return;
+    freePointerTree(node->left);
+    freePointerTree(node->right);
+    delete node;
+}
+
+// --- Word generator ---
+
+vector<Entry> generateEntries(size_t n, mt19937_64& rng) {
+    uniform_int_distribution<int> wordLen(4, 12), meaningLen(12, 40), letter(0, 25);
+    vector<Entry> entries(n);
+    for (size_t i = 0; i < n; i++) {
+        string w = to_string(i) + "_";
+        for (int k = wordLen(rng); k > 0; k--) w += static_cast<char>('a' + letter(rng));
+        string m;
+        for (int k = meaningLen(rng); k > 0; k--) m += static_cast<char>('a' + letter(rng));
+        entries[i] = Entry(w, m);
+    }
+    sort(entries.begin(), entries.end());
+    return entries;
+}
+
+double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+void report(const char* layout, size_t n, size_t bytes, size_t blocks, double build, double teardown) {
+    printf("%s,%zu,%zu,%.1f,%zu,%.6f,%.6f\n", layout, n, bytes, static_cast<double>(bytes) / n, blocks, build,
+           teardown);
+    fflush(stdout);
+}
+
+int main(int argc, char* argv[]) {
+    size_t maxEntries = argc > 1 ? strtoull(argv[1], nullptr, 10) : 1000000;
+    mt19937_64 rng(20240601);
+
+    printf("layout,entries,heap_bytes,bytes_per_entry,allocations,build_seconds,teardown_seconds\n");
+    for (size_t n = 1000; n <= maxEntries; n *= 10) {
+        vector<Entry> entries = generateEntries(n, rng);
+
+        size_t bytesBefore = g_liveBytes, blocksBefore = g_liveBlocks;
+        auto start = chrono::steady_clock::now();
+        PointerNode* tree = buildPointerTree(entries, 0, entries.size());
+        double build = secondsSince(start);
+        size_t bytes = g_liveBytes - bytesBefore, blocks = g_liveBlocks - blocksBefore;
+        start = chrono::steady_clock::now();
+        freePointerTree(tree);
+        report("pointer_nodes", n, bytes, blocks, build, secondsSince(start));
+
+        BST* bst = new BST();
+        bytesBefore = g_liveBytes;
+        blocksBefore = g_liveBlocks;
+        start = chrono::steady_clock::now();
+        bst->bulkLoad(entries);
+        build = secondsSince(start);
+        bytes = g_liveBytes - bytesBefore + sizeof(BST);
+        blocks = g_liveBlocks - blocksBefore + 1;
+
+        RadixTrie* trie = new RadixTrie();
+        size_t trieBytesBefore = g_liveBytes, trieBlocksBefore = g_liveBlocks;
+        auto trieStart = chrono::steady_clock::now();
+        bst->forEachNode([&](NodeId node) { trie->insert(bst->wordAt(node), node); });
+        double trieBuild = secondsSince(trieStart);
+        size_t trieBytes = g_liveBytes - trieBytesBefore + sizeof(RadixTrie);
+        size_t trieBlocks = g_liveBlocks - trieBlocksBefore + 1;
+
+        start = chrono::steady_clock::now();
+        bst->clear();
+        report("arena_nodes", n, bytes, blocks, build, secondsSince(start));
+        delete bst;
+
+        trieStart = chrono::steady_clock::now();
+        trie->clear();
+        report("radix_trie", n, trieBytes, trieBlocks, trieBuild, secondsSince(trieStart));
+        delete trie;
+    }
+    return 0;
+}
@@ -1,53 +1,133 @@
 #include <iostream>
 #include <limits>
 #include <fstream>
-#include "BST.h"
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include <cstdint>
+#include "Dictionary.h"
 
 using namespace std;
 
-void pause() {
+void waitForEnter() {
     cout << "按回车键继续...";
     cin.ignore(numeric_limits<streamsize>::max(), '\n');
     cin.get();
 }
 
-void initDictionary(BST& dictionary) {
+// 加载 dictionary.txt 及其日志 (dictionary.txt.journal), 之后的增删都追加到日志
+template <typename Dict>
+void initDictionary(Dict& dictionary) {
     string defaultFile = "dictionary.txt";
     ifstream f(defaultFile);
-    if (f.good()) {
-        f.close();
-        dictionary.loadFromFile(defaultFile);
-    } else {
-        f.close();
+    if (!f.good()) {
         dictionary.insert("Apple", "苹果");
         dictionary.insert("Banana", "香蕉");
         dictionary.insert("Cat", "猫");
     }
+    f.close();
+    dictionary.open(defaultFile);
 }
 
-int main(int argc, char* argv[]) {
-    BST dictionary;
-    initDictionary(dictionary);
+// 只读命令 (search / fuzzy / view_page) 的快速路径: 直接映射 dictionary.txt.snap,
+// 不解析文本、不建树。快照过期或日志非空时返回 false, 走完整加载
+bool serveFromSnapshot(const string& command, const vector<string>& args, size_t offset, size_t limit) {
+    string defaultFile = "dictionary.txt";
+    error_code ec;
+    uintmax_t journalBytes = filesystem::file_size(Journal::pathFor(defaultFile), ec);
+    if (!ec && journalBytes > 0) return false;
+    DictSnapshot snapshot;
+    if (!snapshot.open(defaultFile)) return false;
 
-    // --- CLI 模式 (供 Python 调用) ---
-    if (argc > 1) {
-        string command = argv[1];
-        if (command == "search") {
-            if (argc < 3) return 1;
-            cout << dictionary.search(argv[2]) << endl;
-        } else if (command == "fuzzy") {
-            if (argc < 3) return 1;
-            dictionary.searchByPrefix(argv[2]);
-        } else if (command == "print_tree") {
-            dictionary.printTree(); 
-        } else if (command == "view_all") { 
-            // [新增功能] 对应菜单 4: 打印所有单词
-            dictionary.inOrder();
-        } 
-        return 0;
+    if (command == "search") {
+        optional<string_view> meaning = snapshot.find(args[0]);
+        cout << (meaning ? *meaning : string_view("Word not found in the dictionary.")) << endl;
+    } else if (command == "view_page") {
+        printPage(snapshot.size(), offset, [&](auto print) { snapshot.forEachInPage(offset, limit, print); });
+    } else {
+        string_view prefix = args.empty() ? "" : args[0];
+        printPrefixMatches(prefix, [&](auto print) { snapshot.forEachPrefix(prefix, offset, limit, print); });
+    }
+    return true;
+}
+
+// 两种后端共有的命令; 未识别的命令返回 -1
+template <typename Dict>
+int runCommonCommand(Dict& dictionary, const string& command, const vector<string>& args, size_t offset,
+                     size_t limit) {
+    if (command == "search") {
+        optional<string_view> meaning = dictionary.find(args[0]);
+        cout << (meaning ? *meaning : string_view("Word not found in the dictionary.")) << endl;
+    } else if (command == "fuzzy") {
+        dictionary.searchByPrefix(args.empty() ? "" : args[0], offset, limit);
+    } else if (command == "add") {
+        // 增加/修改单词: 只向日志追加一条记录, 不重写整个文件
+        if (args.size() < 2) return 1;
+        return dictionary.insert(args[0], args[1]) ? 0 : 1;
+    } else if (command == "delete") {
+        if (args.empty()) return 1;
+        return dictionary.remove(args[0]) ? 0 : 1;
+    } else if (command == "compact") {
+        // 把日志合并进新的 dictionary.txt 快照
+        return dictionary.compact() ? 0 : 1;
+    } else if (command == "print_tree") {
+        dictionary.printTree();
+    } else if (command == "view_all") {
+        // [新增功能] 对应菜单 4: 打印所有单词
+        dictionary.inOrder();
+    } else if (command == "view_page") {
+        dictionary.viewPage(offset, limit);
+    } else if (command == "check_tree") {
+        // 校验树的结构不变量 (AVL 后端还校验索引与树一致)
+        return dictionary.checkTree() ? 0 : 1;
+    } else if (command == "index_stats") {
+        // 树与各索引的内存占用
+        dictionary.printMemory();
+    } else {
+        return -1;
     }
+    return 0;
+}
+
+// AVL 后端: 另外支持依赖子树大小或基数树的命令
+int runCommand(Dictionary& dictionary, const string& command, const vector<string>& args, size_t offset,
+               size_t limit) {
+    if (command == "fuzzy_edit") {
+        // 纠错搜索: fuzzy_edit <word> [maxdist], 按编辑距离排序
+        if (args.empty()) return 1;
+        int maxDist = args.size() > 1 ? atoi(args[1].c_str()) : 2;
+        dictionary.searchByEditDistance(args[0], maxDist, limit);
+    } else if (command == "rank") {
+        // rank <word>: 排在该单词之前的单词数
+        if (args.empty()) return 1;
+        cout << dictionary.tree().rank(args[0]) << endl;
+    } else if (command == "count_range") {
+        // count_range <lo> <hi>: 满足 lo <= w <= hi 的单词数
+        if (args.size() < 2) return 1;
+        cout << dictionary.tree().countRange(args[0], args[1]) << endl;
+    } else if (command == "tree_json") {
+        // 树结构 JSON (供 Python 可视化)
+        dictionary.tree().printTreeJSON();
+    } else {
+        return max(runCommonCommand(dictionary, command, args, offset, limit), 0);
+    }
+    return 0;
+}
+
+// B+ 树后端
+int runCommand(BTreeDictionary& dictionary, const string& command, const vector<string>& args, size_t offset,
+               size_t limit) {
+    int status = runCommonCommand(dictionary, command, args, offset, limit);
+    if (status < 0) {
+        cout << "B+ 树后端不支持该命令: " << command << endl;
+        return 1;
+    }
+    return status;
+}
 
-    // --- 交互菜单模式 ---
+// --- 交互菜单模式 ---
+template <typename Dict>
+int runMenu(Dict& dictionary) {
     int choice;
     string word, meaning, filename;
     do {
@@ -73,4 +153,70 @@ int main(int argc, char* argv[]) {
         }
     } while (choice != 0);
     return 0;
-}
\ No newline at end of file
+}
+
+int main(int argc, char* argv[]) {
+    // 启动参数 --backend avl|btree 选择字典后端 (默认 AVL 树), 可放在任意位置
+    string backend = "avl";
+    vector<string> argList;
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "--backend" && i + 1 < argc) {
+            backend = argv[++i];
+        } else {
+            argList.push_back(arg);
+        }
+    }
+    if (backend != "avl" && backend != "btree") {
+        cout << "未知后端: " << backend << " (可选 avl / btree)" << endl;
+        return 1;
+    }
+
+    // --- CLI 模式 (供 Python 调用) ---
+    if (!argList.empty()) {
+        string command = argList[0];
+        // 可选参数: --limit N --offset N (用于分页 / 自动补全)
+        vector<string> args;
+        size_t limit = SIZE_MAX, offset = 0;
+        for (size_t i = 1; i < argList.size(); i++) {
+            if (argList[i] == "--limit" && i + 1 < argList.size()) {
+                limit = strtoull(argList[++i].c_str(), nullptr, 10);
+            } else if (argList[i] == "--offset" && i + 1 < argList.size()) {
+                offset = strtoull(argList[++i].c_str(), nullptr, 10);
+            } else {
+                args.push_back(argList[i]);
+            }
+        }
+
+        if ((command == "search" || command == "fuzzy") && argList.size() < 2) return 1;
+        if (command == "search" && args.empty()) return 1;
+        if (command == "view_page") {
+            // view_page <offset> <limit>: 只输出一页 (按名次定位, 不遍历整棵树)
+            if (args.size() >= 1) offset = strtoull(args[0].c_str(), nullptr, 10);
+            limit = args.size() >= 2 ? strtoull(args[1].c_str(), nullptr, 10) : 20;
+        }
+        // 快照与后端无关: 两种后端写出的文件格式相同
+        if ((command == "search" || command == "fuzzy" || command == "view_page") &&
+            serveFromSnapshot(command, args, offset, limit)) {
+            return 0;
+        }
+
+        if (backend == "btree") {
+            BTreeDictionary dictionary;
+            initDictionary(dictionary);
+            return runCommand(dictionary, command, args, offset, limit);
+        }
+        Dictionary dictionary;
+        initDictionary(dictionary);
+        return runCommand(dictionary, command, args, offset, limit);
+    }
+
+    if (backend == "btree") {
+        BTreeDictionary dictionary;
+        initDictionary(dictionary);
+        return runMenu(dictionary);
+    }
+    Dictionary dictionary;
+    initDictionary(dictionary);
+    return runMenu(dictionary);
+}
@@ -0,0 +1,123 @@
+// AVL balance test for the dictionary BST.
+//
+// Usage: test_bst_balance [entries]
+//
+// Loads a sorted dictionary file (the order saveToFile writes, which used to
+// degenerate the tree into a list) and also inserts the same sorted words
+// one at a time. Then runs random inserts and removes against a std::map.
+// checkBalance() must pass throughout; it covers key order, the AVL height
+// bound and the stored subtree sizes. rank, countRange and forEachInPage
+// must agree with the map. Exits non-zero on the first failure.
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <map>
+#include <random>
+#include <iterator>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include "BST.h"
+
+using namespace std;
+
+string randomWord(mt19937_64& rng) {
+    uniform_int_distribution<int> wordLen(1, 6), letter(0, 7);
+    string w;
+    for (int k = wordLen(rng); k > 0; k--) w += static_cast<char>('a' + letter(rng));
+    return w;
+}
+
+// checkBalance with its report kept quiet
+bool balanced(const BST& tree) {
+    streambuf* saved = cout.rdbuf(nullptr);
+    bool ok = tree.checkBalance();
+    cout.rdbuf(saved);
+    return ok;
+}
+
+// Order statistics against the reference map
+bool sameOrder(const BST& tree, const map<string, string>& reference, mt19937_64& rng) {
+    if (tree.size() != reference.size()) return false;
+    for (int q = 0; q < 20; q++) {
+        string lo = randomWord(rng), hi = randomWord(rng);
+        auto first = reference.lower_bound(lo);
+        if (tree.rank(lo) != static_cast<size_t>(distance(reference.begin(), first))) return false;
+        size_t inRange = hi < lo ? 0 : distance(first, reference.upper_bound(hi));
+        if (tree.countRange(lo, hi) != inRange) return false;
+    }
+    size_t offset = reference.empty() ? 0 : rng() % reference.size(), limit = 10;
+    vector<string> page;
+    tree.forEachInPage(offset, limit, [&](string_view w, string_view) { page.emplace_back(w); });
+    auto it = reference.begin();
+    advance(it, offset);
+    for (const string& w : page) {
+        if (it == reference.end() || it->first != w) return false;
+        ++it;
+    }
+    return page.size() == min(limit, reference.size() - offset);
+}
+
+bool fail(const char* what) {
+    fprintf(stderr, "test_bst_balance: %s\n", what);
+    return false;
+}
+
+bool run(size_t n) {
+    mt19937_64 rng(20240613);
+    map<string, string> reference;
+    for (size_t i = 0; i < n; i++) {
+        string w = randomWord(rng) + to_string(i);
+        reference[w] = "meaning of " + w;
+    }
+
+    // Sorted input, through the file path and one insert at a time
+    string path = "test_bst_balance.txt";
+    {
+        ofstream out(path);
+        for (const auto& [w, m] : reference) out << w << ":" << m << "\n";
+    }
+    BST tree;
+    streambuf* saved = cout.rdbuf(nullptr);
+    tree.loadFromFile(path);
+    cout.rdbuf(saved);
+    remove(path.c_str());
+    if (!balanced(tree) || !sameOrder(tree, reference, rng)) return fail("sorted load");
+
+    BST inserted;
+    for (const auto& [w, m] : reference) inserted.insert(w, m);
+    if (!balanced(inserted) || !sameOrder(inserted, reference, rng)) return fail("sorted inserts");
+
+    // Random churn on the loaded tree; removes pick a random word or one of
+    // the loaded ones
+    vector<string> loaded;
+    for (const auto& entry : reference) loaded.push_back(entry.first);
+    for (size_t i = 0; i < 4 * n; i++) {
+        string w = rng() % 4 ? randomWord(rng) : loaded[rng() % loaded.size()];
+        if (rng() % 2) {
+            tree.insert(w, "churn");
+            reference[w] = "churn";
+        } else if (reference.erase(w) > 0) {
+            tree.remove(w);
+        }
+        if (i % (n / 20 + 1) == 0 && (!balanced(tree) || !sameOrder(tree, reference, rng))) {
+            return fail("random inserts and removes");
+        }
+    }
+    if (!balanced(tree) || !sameOrder(tree, reference, rng)) return fail("random inserts and removes");
+
+    // Drain
+    for (const auto& entry : reference) tree.remove(entry.first);
+    reference.clear();
+    if (!balanced(tree) || tree.size() != 0) return fail("drain");
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    size_t n = max<size_t>(1, argc > 1 ? strtoull(argv[1], nullptr, 10) : 20000);
+    if (!run(n)) return 1;
+    printf("AVL balance OK: %zu sorted entries, random inserts and removes\n", n);
+    return 0;
+}
@@ -5,6 +5,7 @@ import os
 import graphviz
 import re
 import io
+import json
 
 # ================= 配置区 =================
 st.set_page_config(
@@ -124,35 +125,19 @@ def draw_bst_from_file():
     dot.attr(rankdir="TB")
     dot.attr("node", shape="oval", style="filled", fillcolor="lightblue")
 
-    class Node:
-        def __init__(self, key):
-            self.key = key
-            self.left = None
-            self.right = None
-
-    def insert(root, key):
-        if not root:
-            return Node(key)
-        if key < root.key:
-            root.left = insert(root.left, key)
-        elif key > root.key:
-            root.right = insert(root.right, key)
-        return root
-
-    words = [line.split(":")[0].strip() for line in open(DICT_FILE) if ":" in line]
-    root = None
-    for w in words:
-        root = insert(root, w)
+    # 树结构由 C++ 端输出 (AVL 平衡后的真实形状)
+    out = run_cpp("Topic2_Dictionary", ["tree_json"])
+    try:
+        root = json.loads(out.splitlines()[-1])
+    except (ValueError, IndexError):
+        return None
 
     def traverse(node):
-        if node:
-            dot.node(node.key)
-            if node.left:
-                dot.edge(node.key, node.left.key, "L")
-                traverse(node.left)
-            if node.right:
-                dot.edge(node.key, node.right.key, "R")
-                traverse(node.right)
+        if node and "name" in node:
+            dot.node(node["name"])
+            for child in node.get("children", []):
+                dot.edge(node["name"], child["name"], child.get("side", ""))
+                traverse(child)
 
     traverse(root)
     return dot
@@ -227,20 +212,26 @@ if "1." in menu:
                 nscore = cols[2].text_input("成绩")
                 if st.form_submit_button("添加"):
                     if nid and nname and nscore:
-                        with open(STUDENT_FILE, "a") as f:
-                            f.write(f"\n{nid} {nname} {nscore}")
-                        st.success("成功")
-                        st.rerun()
+                        # 由后端追加记录并增量更新排序索引
+                        res = run_cpp(
+                            "Topic1_Student", ["add", nid, nname, nscore, STUDENT_FILE]
+                        )
+                        if res.startswith("运行异常") or res.startswith("系统"):
+                            st.error(res)
+                        else:
+                            st.success("成功")
+                            st.rerun()
         with c2:
             with st.form("del"):
                 st.write("➖ 删除学生")
                 did = st.text_input("输入学号")
                 if st.form_submit_button("删除"):
-                    lines = [l for l in open(STUDENT_FILE) if not l.startswith(did)]
-                    with open(STUDENT_FILE, "w") as f:
-                        f.writelines(lines)
-                    st.success("已删除")
-                    st.rerun()
+                    res = run_cpp("Topic1_Student", ["delete", did, STUDENT_FILE])
+                    if res.startswith("运行异常") or res.startswith("系统"):
+                        st.error(res)
+                    else:
+                        st.success("已删除")
+                        st.rerun()
 
     with tab2:
         st.subheader("算法排序结果")
@@ -269,6 +260,26 @@ if "1." in menu:
             if st.button("按成绩排序 (HeapSort)"):
                 show_sorted_result("堆排序", ["sort_score", STUDENT_FILE])
 
+        st.divider()
+        if st.button("成绩统计"):
+            res_text = run_cpp("Topic1_Student", ["stats", STUDENT_FILE, "--json"])
+            try:
+                stats = json.loads(res_text)
+                m = st.columns(5)
+                m[0].metric("人数", stats["count"])
+                m[1].metric("平均分", f"{stats['mean']:.2f}")
+                m[2].metric("标准差", f"{stats['stddev']:.2f}")
+                m[3].metric("最低分", stats["min"])
+                m[4].metric("最高分", stats["max"])
+                st.dataframe(
+                    pd.DataFrame([stats["percentiles"]]), use_container_width=True
+                )
+                hist = pd.DataFrame(stats["histogram"]).set_index("bin")
+                st.bar_chart(hist["count"])
+            except Exception:
+                st.error("统计失败")
+                st.text(res_text)
+
 # --- Topic 2: 字典系统 ---
 elif "2." in menu:
     st.header("🌲 专题二：字典检索系统")
@@ -279,10 +290,22 @@ elif "2." in menu:
         c1, c2 = st.columns([2, 1])
         with c1:
             w = st.text_input("输入单词")
+            if w:
+                # 自动补全: 只取前 10 个前缀匹配 (范围扫描, 不遍历整棵树)
+                out = run_cpp("Topic2_Dictionary", ["fuzzy", w, "--limit", "10"])
+                lines = out.splitlines()
+                if "-" * 40 in lines:
+                    start = lines.index("-" * 40) + 1
+                    hints = [l.split(":")[0].strip() for l in lines[start:] if l != "-" * 40]
+                    if hints:
+                        st.caption("联想: " + " · ".join(hints))
             if st.button("精确查找"):
                 st.info(run_cpp("Topic2_Dictionary", ["search", w]))
             if st.button("前缀匹配"):
                 st.text(run_cpp("Topic2_Dictionary", ["fuzzy", w]))
+            if st.button("纠错搜索"):
+                # 编辑距离 <= 2 的单词, 按距离排序
+                st.text(run_cpp("Topic2_Dictionary", ["fuzzy_edit", w, "2"]))
             st.divider()
             if st.button("刷新树结构"):
                 st.rerun()
@@ -301,18 +324,21 @@ elif "2." in menu:
                 w = st.text_input("单词")
                 m = st.text_input("释义")
                 if st.form_submit_button("保存"):
-                    with open(DICT_FILE, "a") as f:
-                        f.write(f"\n{w}:{m}")
+                    # 只追加一条日志记录, 不重写整个词典文件
+                    run_cpp("Topic2_Dictionary", ["add", w, m])
                     st.success("已保存")
         with c2:
             with st.form("del_w"):
                 dw = st.text_input("删除单词")
                 if st.form_submit_button("删除"):
-                    lines = [l for l in open(DICT_FILE) if not l.startswith(dw + ":")]
-                    with open(DICT_FILE, "w") as f:
-                        f.writelines(lines)
+                    run_cpp("Topic2_Dictionary", ["delete", dw])
                     st.success("已删除")
-        st.text_area("当前数据", open(DICT_FILE).read(), height=150)
+        if st.button("合并日志"):
+            # 把增删日志合并进新的 dictionary.txt 快照
+            run_cpp("Topic2_Dictionary", ["compact"])
+        # 分页浏览: 只取当前页 (按名次定位, 不输出整个词典)
+        page = st.number_input("页码", min_value=1, value=1, step=1)
+        st.text_area("当前数据", run_cpp("Topic2_Dictionary", ["view_page", str((page - 1) * 50), "50"]), height=150)
 
 # --- Topic 3: 校园导航 ---
 elif "3." in menu: